@@ -0,0 +1,62 @@
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/batch_math.hpp>
+#include <boost/safe_float/cmath.hpp>
+#include <boost/safe_float/convenience.hpp>
+
+using namespace boost::safe_float;
+
+/**
+  This benchmark compares the batch math functions over arrays of safe_float with loops of the checked math functions
+  of cmath.hpp. No check fails.
+  */
+
+constexpr std::size_t size = 1 << 16;
+constexpr long repetitions = 200;
+
+template<class F>
+double ns_per_value(F&& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < repetitions; ++i) f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / (repetitions * size);
+}
+
+template<class SF, class SCALAR, class BATCH>
+void run(const char* name, const std::vector<SF>& values, std::vector<SF>& out, SCALAR scalar, BATCH batch_function)
+{
+    double const loop = ns_per_value([&] {
+        for (std::size_t i = 0; i < size; ++i) out[i] = scalar(values[i]);
+    });
+    double const batched = ns_per_value([&] { batch_function(values.data(), out.data(), size); });
+    std::printf("%-8s %10.2f %10.2f %8.1fx\n", name, loop, batched, loop / batched);
+}
+
+template<class FP>
+void run_all(const char* type)
+{
+    using SF = safe_float<FP, policy::check_bothflow>;
+    std::vector<SF> values, out(size), exponents(size, SF(FP(1.5)));
+    for (std::size_t i = 0; i < size; ++i) values.push_back(SF(FP(1) + FP(i % 100) / 7));
+    std::printf("safe_float<%s, check_bothflow>, ns per value\n", type);
+    std::printf("%-8s %10s %10s %9s\n", "function", "loop", "batch", "speedup");
+    run("exp", values, out, [](const SF& v) { return exp(v); }, [](auto... a) { batch::exp(a...); });
+    run("log", values, out, [](const SF& v) { return log(v); }, [](auto... a) { batch::log(a...); });
+    run("sqrt", values, out, [](const SF& v) { return sqrt(v); }, [](auto... a) { batch::sqrt(a...); });
+    run("sin", values, out, [](const SF& v) { return sin(v); }, [](auto... a) { batch::sin(a...); });
+    run("cos", values, out, [](const SF& v) { return cos(v); }, [](auto... a) { batch::cos(a...); });
+    run("pow", values, out, [&](const SF& v) { return pow(v, exponents[0]); },
+        [&](const SF* x, SF* o, std::size_t n) { batch::pow(x, exponents.data(), o, n); });
+}
+
+int main()
+{
+    run_all<float>("float");
+    run_all<double>("double");
+    return 0;
+}
@@ -0,0 +1,76 @@
+#include <chrono>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/charconv.hpp>
+
+using namespace boost::safe_float;
+
+/**
+  This benchmark compares writing and reading safe_float with to_chars and from_chars to the stream operators, over
+  a text of space separated numbers as the data ingestion reads.
+  */
+
+constexpr std::size_t size = 100000;
+constexpr long repetitions = 10;
+
+template<class F>
+double ns_per_value(F&& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < repetitions; ++i) f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / (repetitions * size);
+}
+
+template<class FP>
+void run(const char* type)
+{
+    using SF = safe_float<FP>;
+    std::vector<SF> values, read(size);
+    for (std::size_t i = 0; i < size; ++i) values.push_back(SF(FP(i % 1000) + FP(0.125) * FP(i % 8)));
+
+    std::string text;
+    double const stream_write = ns_per_value([&] {
+        std::ostringstream out;
+        for (auto const& v : values) out << v << ' ';
+        text = out.str();
+    });
+    double const stream_read = ns_per_value([&] {
+        std::istringstream in(text);
+        for (auto& v : read) in >> v;
+    });
+
+    std::vector<char> buffer(size * 64);
+    char* end = buffer.data();
+    double const charconv_write = ns_per_value([&] {
+        char* p = buffer.data();
+        char* const last = buffer.data() + buffer.size();
+        for (auto const& v : values)
+        {
+            p = to_chars(p, last, v).ptr;
+            *p++ = ' ';
+        }
+        end = p;
+    });
+    double const charconv_read = ns_per_value([&] {
+        char const* p = buffer.data();
+        for (auto& v : read) p = from_chars(p, end, v).ptr + 1;
+    });
+
+    std::printf("%-12s %-6s %10.2f %10.2f\n", type, "write", stream_write, charconv_write);
+    std::printf("%-12s %-6s %10.2f %10.2f\n", type, "read", stream_read, charconv_read);
+}
+
+int main()
+{
+    std::printf("text conversions, ns per value\n");
+    std::printf("%-12s %-6s %10s %10s\n", "type", "test", "iostream", "charconv");
+    run<float>("float");
+    run<double>("double");
+    run<long double>("long double");
+    return 0;
+}
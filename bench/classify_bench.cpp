@@ -0,0 +1,83 @@
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+#include <boost/safe_float/policy/classify.hpp>
+
+using namespace boost::safe_float;
+
+/**
+  This benchmark compares the bit level classification of policy::classify, used by the software checks, with the
+  <cmath> functions over arrays mixing normal, subnormal, zero and infinite values.
+  */
+
+constexpr std::size_t size = 4096;
+constexpr long repetitions = 2000;
+
+template<class F>
+double ns_per_value(F&& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < repetitions; ++i) f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / (repetitions * size);
+}
+
+template<class FP>
+std::vector<FP> mixed_values()
+{
+    std::vector<FP> values;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        switch (i % 8)
+        {
+        case 0: values.push_back(std::numeric_limits<FP>::denorm_min() * FP(i)); break;
+        case 1: values.push_back(0); break;
+        case 2: values.push_back(std::numeric_limits<FP>::infinity()); break;
+        default: values.push_back(FP(i) / 3); break;
+        }
+    }
+    return values;
+}
+
+// counts the values classified by classify(value)
+template<class FP, class CLASSIFY>
+double count(const std::vector<FP>& values, CLASSIFY classify, volatile long& sink)
+{
+    long found = 0;
+    double const ns = ns_per_value([&] {
+        for (FP v : values) found += classify(v);
+    });
+    sink = found;
+    return ns;
+}
+
+template<class FP>
+void run(const char* type, volatile long& sink)
+{
+    auto const values = mixed_values<FP>();
+    namespace classify = policy::classify;
+    namespace cmath = policy::classify::detail;
+    std::printf("%-12s %-12s %10.2f %10.2f\n", type, "is_inf",
+                count(values, [](FP v) { return cmath::cmath_layout::is_inf(v); }, sink),
+                count(values, [](FP v) { return classify::is_inf(v); }, sink));
+    std::printf("%-12s %-12s %10.2f %10.2f\n", type, "is_nan",
+                count(values, [](FP v) { return cmath::cmath_layout::is_nan(v); }, sink),
+                count(values, [](FP v) { return classify::is_nan(v); }, sink));
+    std::printf("%-12s %-12s %10.2f %10.2f\n", type, "is_subnormal",
+                count(values, [](FP v) { return cmath::cmath_layout::is_subnormal(v); }, sink),
+                count(values, [](FP v) { return classify::is_subnormal(v); }, sink));
+}
+
+int main()
+{
+    volatile long sink = 0;
+    std::printf("classification, ns per value\n");
+    std::printf("%-12s %-12s %10s %10s\n", "type", "test", "cmath", "bits");
+    run<float>("float", sink);
+    run<double>("double", sink);
+    run<long double>("long double", sink);
+    return 0;
+}
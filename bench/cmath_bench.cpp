@@ -0,0 +1,55 @@
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/cmath.hpp>
+#include <boost/safe_float/convenience.hpp>
+
+using namespace boost::safe_float;
+
+/**
+  This benchmark compares the checked math functions of safe_float with unwrapping the value, calling <cmath> and
+  wrapping the result, which doesn't check it. No check fails.
+  */
+
+constexpr std::size_t size = 4096;
+constexpr long repetitions = 1000;
+
+template<class F>
+double ns_per_call(F&& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < repetitions; ++i) f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / (repetitions * size);
+}
+
+template<class SF, class UNWRAPPED, class CHECKED>
+void run(const char* name, const std::vector<SF>& values, std::vector<SF>& out, UNWRAPPED unwrapped, CHECKED checked)
+{
+    double const rewrap = ns_per_call([&] {
+        for (std::size_t i = 0; i < size; ++i) out[i] = SF(unwrapped(values[i].get_stored_value()));
+    });
+    double const check = ns_per_call([&] {
+        for (std::size_t i = 0; i < size; ++i) out[i] = checked(values[i]);
+    });
+    std::printf("%-8s %10.2f %10.2f\n", name, rewrap, check);
+}
+
+int main()
+{
+    using SF = safe_float<double, policy::check_bothflow>;
+    std::vector<SF> values, out(size);
+    for (std::size_t i = 0; i < size; ++i) values.push_back(SF(1 + double(i % 100) / 7));
+    SF const half(0.5);
+    std::printf("checked math functions of safe_float<double, check_bothflow>, ns per call\n");
+    std::printf("%-8s %10s %10s\n", "function", "rewrap", "checked");
+    run("sqrt", values, out, [](double v) { return std::sqrt(v); }, [](const SF& v) { return sqrt(v); });
+    run("exp", values, out, [](double v) { return std::exp(v); }, [](const SF& v) { return exp(v); });
+    run("log", values, out, [](double v) { return std::log(v); }, [](const SF& v) { return log(v); });
+    run("pow", values, out, [](double v) { return std::pow(v, 0.5); }, [&](const SF& v) { return pow(v, half); });
+    run("sin", values, out, [](double v) { return std::sin(v); }, [](const SF& v) { return sin(v); });
+    return 0;
+}
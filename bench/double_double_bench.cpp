@@ -0,0 +1,75 @@
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/convenience.hpp>
+#include <boost/safe_float/double_double.hpp>
+
+using namespace boost::safe_float;
+
+/**
+  This benchmark compares the cost of the operations of safe_float<FP, check_bothflow> for double, long double and
+  double_double, and the cost of the checks over the raw FP, in ns per operation. A dot product is computed in the
+  order of the values. No check fails.
+  */
+
+constexpr std::size_t size = 1 << 12;
+constexpr long repetitions = 2000;
+
+template<class F>
+double ns_per_operation(F&& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < repetitions; ++i) f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / (repetitions * size);
+}
+
+template<class T>
+void run(const char* name, const std::vector<T>& a, const std::vector<T>& b, std::vector<T>& out)
+{
+    double const add = ns_per_operation([&] {
+        for (std::size_t i = 0; i < size; ++i) out[i] = a[i] + b[i];
+    });
+    double const multiply = ns_per_operation([&] {
+        for (std::size_t i = 0; i < size; ++i) out[i] = a[i] * b[i];
+    });
+    double const divide = ns_per_operation([&] {
+        for (std::size_t i = 0; i < size; ++i) out[i] = a[i] / b[i];
+    });
+    double const dot = ns_per_operation([&] {
+        T sum = a[0] * b[0];
+        for (std::size_t i = 1; i < size; ++i) sum = sum + a[i] * b[i];
+        out[0] = sum;
+    });
+    std::printf("%-30s %8.2f %8.2f %8.2f %8.2f\n", name, add, multiply, divide, dot);
+}
+
+template<class FP>
+void run_all(const char* type)
+{
+    using SF = safe_float<FP, policy::check_bothflow>;
+    std::vector<FP> a, b, out(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        a.push_back(FP(1) + FP(double(i % 100)) / FP(7));
+        b.push_back(FP(2) - FP(double(i % 31)) / FP(37));
+    }
+    std::vector<SF> sa(a.begin(), a.end()), sb(b.begin(), b.end()), sout(size, SF(FP(0)));
+    char name[64];
+    std::snprintf(name, sizeof(name), "%s", type);
+    run(name, a, b, out);
+    std::snprintf(name, sizeof(name), "safe_float<%s>", type);
+    run(name, sa, sb, sout);
+}
+
+int main()
+{
+    std::printf("check_bothflow, ns per operation\n");
+    std::printf("%-30s %8s %8s %8s %8s\n", "type", "add", "multiply", "divide", "dot");
+    run_all<double>("double");
+    run_all<long double>("long double");
+    run_all<double_double>("double_double");
+    return 0;
+}
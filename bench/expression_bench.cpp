@@ -0,0 +1,73 @@
+#include <chrono>
+#include <cstdio>
+
+#define BOOST_SAFE_FLOAT_EXPRESSION_TEMPLATES
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/convenience.hpp>
+
+using namespace boost::safe_float;
+
+/**
+  This benchmark compares an expression checked once through the expression templates against the same expression
+  checked operation by operation, as the eager operators do.
+  */
+
+template<typename F>
+double ns_per_op(F&& f, long iterations)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < iterations; ++i) f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / iterations;
+}
+
+template<template<typename> typename CHECK>
+void run(const char* name, double one, long iterations, volatile double& sink)
+{
+    using sf = safe_float<double, CHECK>;
+    sf acc(0.0), b(one), c(one + one), d(one), e(one + one);
+
+    // acc = acc*b + c*d - e, one operation at a time
+    double eager = ns_per_op(
+        [&] {
+            sf lhs(acc), rhs(c);
+            lhs *= b;
+            rhs *= d;
+            lhs += rhs;
+            lhs -= e;
+            acc = lhs;
+        },
+        iterations);
+    sink = acc.get_stored_value();
+
+    double expression = ns_per_op([&] { acc = acc*b + c*d - e; }, iterations);
+    sink = acc.get_stored_value();
+    std::printf("%-20s %12.2f %12.2f\n", name, eager, expression);
+}
+
+int main()
+{
+    constexpr long iterations = 10000000;
+
+    volatile double sink = 0;
+    // kept opaque so the compiler cannot fold the operations away
+    double const one = sink + 1.0;
+
+#ifdef FENV_AVAILABLE
+    std::printf("acc = acc*b + c*d - e, FE_* flags checks\n");
+#else
+    std::printf("acc = acc*b + c*d - e, software checks\n");
+#endif
+    std::printf("%-20s %12s %12s\n", "policy", "eager ns", "expr ns");
+
+    double acc = 0.0, b = one, c = one + one, d = one, e = one + one;
+    double raw = ns_per_op([&] { acc = acc*b + c*d - e; }, iterations);
+    sink = acc;
+    std::printf("%-20s %12.2f %12.2f\n", "raw double", raw, raw);
+
+    run<policy::check_addition_overflow>("addition_overflow", one, iterations, sink);
+    run<policy::check_overflow>("overflow", one, iterations, sink);
+    run<policy::check_inexact_rounding>("inexact_rounding", one, iterations, sink);
+    run<policy::check_all>("all", one, iterations, sink);
+    return 0;
+}
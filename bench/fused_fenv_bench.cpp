@@ -0,0 +1,212 @@
+#include <chrono>
+#include <cstdio>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/convenience.hpp>
+
+#ifdef FENV_AVAILABLE
+#pragma STDC FENV_ACCESS ON
+#include <fenv.h>
+#endif
+
+using namespace boost::safe_float;
+
+/**
+  This benchmark compares the fused FE_* flag handling of composed_check against calling every sub-policy in turn,
+  which is what composed_check used to do before. Both are replayed over the std::feclearexcept/std::fetestexcept
+  calls, counted per operation, so they differ only by the fusion. The safe_float row is the library itself, on the
+  flag access of the build (MXCSR for double when BOOST_SAFE_FLOAT_HAS_MXCSR is defined), its calls aren't counted.
+  */
+
+// The flag functions of the replays, counting their calls
+namespace counted
+{
+long flag_calls = 0;
+
+inline void clear(int flags)
+{
+    ++flag_calls;
+#ifdef FENV_AVAILABLE
+    std::feclearexcept(flags);
+#endif
+}
+
+inline int test(int flags)
+{
+    ++flag_calls;
+#ifdef FENV_AVAILABLE
+    return std::fetestexcept(flags);
+#else
+    return 0;
+#endif
+}
+} // namespace counted
+
+// The sub-policies of the compositions, flattened
+template<typename FP, typename P>
+struct leaves
+{
+    using type = std::tuple<P>;
+};
+
+template<typename FP, template<typename> typename... As>
+struct leaves<FP, policy::composed_check<FP, As...>>
+{
+    using type = decltype(std::tuple_cat(std::declval<typename leaves<FP, As<FP>>::type>()...));
+};
+
+template<typename FP, typename P>
+using traits = policy::policy_traits<FP, std::decay_t<P>>;
+
+// FUSED = false replays the old behaviour: every sub-policy clears and tests its own flags
+// FUSED = true clears the union of the flags once before the operation and tests it once after
+template<typename FP, typename CHECK, bool FUSED>
+struct replay
+{
+    typename leaves<FP, CHECK>::type policies;
+    policy::on_fail_throw handler;
+
+    void add(FP& number, FP rhs)
+    {
+        FP lhs = number;
+        std::apply([&](auto&... p) {
+            constexpr int fused_flags = (traits<FP, decltype(p)>::addition_fenv_flags() | ... | 0);
+            if constexpr (FUSED && fused_flags != 0) counted::clear(fused_flags);
+            (
+                [&] {
+                    constexpr int flags = traits<FP, decltype(p)>::addition_fenv_flags();
+                    if constexpr (flags == 0)
+                        traits<FP, decltype(p)>::report_pre_addition(p, lhs, rhs, handler);
+                    else if constexpr (!FUSED)
+                        counted::clear(flags);
+                }(),
+                ...);
+            policy::fenv_flags::fence<FP>(lhs, rhs);
+            number = lhs + rhs;
+            policy::fenv_flags::fence<FP>(number);
+            int const raised = FUSED && fused_flags != 0 ? counted::test(fused_flags) : 0;
+            (
+                [&] {
+                    constexpr int flags = traits<FP, decltype(p)>::addition_fenv_flags();
+                    if constexpr (flags == 0)
+                        traits<FP, decltype(p)>::report_post_addition(p, lhs, rhs, number, handler);
+                    else if ((FUSED ? raised & flags : counted::test(flags)) != 0)
+                        throw std::runtime_error(p.addition_failure_message());
+                }(),
+                ...);
+        }, policies);
+    }
+
+    void divide(FP& number, FP rhs)
+    {
+        FP lhs = number;
+        std::apply([&](auto&... p) {
+            constexpr int fused_flags = (traits<FP, decltype(p)>::division_fenv_flags() | ... | 0);
+            if constexpr (FUSED && fused_flags != 0) counted::clear(fused_flags);
+            (
+                [&] {
+                    constexpr int flags = traits<FP, decltype(p)>::division_fenv_flags();
+                    if constexpr (flags == 0)
+                        traits<FP, decltype(p)>::report_pre_division(p, lhs, rhs, handler);
+                    else if constexpr (!FUSED)
+                        counted::clear(flags);
+                }(),
+                ...);
+            policy::fenv_flags::fence<FP>(lhs, rhs);
+            number = lhs / rhs;
+            policy::fenv_flags::fence<FP>(number);
+            int const raised = FUSED && fused_flags != 0 ? counted::test(fused_flags) : 0;
+            (
+                [&] {
+                    constexpr int flags = traits<FP, decltype(p)>::division_fenv_flags();
+                    if constexpr (flags == 0)
+                        traits<FP, decltype(p)>::report_post_division(p, lhs, rhs, number, handler);
+                    else if ((FUSED ? raised & flags : counted::test(flags)) != 0)
+                        throw std::runtime_error(p.division_failure_message());
+                }(),
+                ...);
+        }, policies);
+    }
+};
+
+template<typename F>
+double ns_per_op(F&& f, long iterations)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < iterations; ++i) f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / iterations;
+}
+
+// Flag calls per operation of the replay running f
+template<typename F>
+double flag_calls_per_op(F&& f)
+{
+    long const before = counted::flag_calls;
+    f();
+    return double(counted::flag_calls - before);
+}
+
+int main()
+{
+    constexpr long iterations = 10000000;
+    using check = policy::check_all<double>;
+
+    volatile double sink = 0;
+    // kept opaque so the compiler cannot fold the operations away
+    double const one = sink + 1.0;
+
+    replay<double, check, false> unfused;
+    replay<double, check, true> fused;
+    double acc = 0.0;
+    double const unfused_add_calls = flag_calls_per_op([&] { unfused.add(acc, one); });
+    double const fused_add_calls = flag_calls_per_op([&] { fused.add(acc, one); });
+    double const unfused_div_calls = flag_calls_per_op([&] { unfused.divide(acc, one); });
+    double const fused_div_calls = flag_calls_per_op([&] { fused.divide(acc, one); });
+
+    double raw_acc = 0.0;
+    double const raw_add = ns_per_op([&] { raw_acc += one; }, iterations);
+    sink = raw_acc;
+
+    acc = 0.0;
+    double const unfused_add = ns_per_op([&] { unfused.add(acc, one); }, iterations);
+    sink = acc;
+
+    acc = 0.0;
+    double const fused_add = ns_per_op([&] { fused.add(acc, one); }, iterations);
+    sink = acc;
+
+    safe_float<double> sf_acc(0.0), sf_one(one);
+    double const library_add = ns_per_op([&] { sf_acc += sf_one; }, iterations);
+    sink = sf_acc.get_stored_value();
+
+    double q = 1.0;
+    double const unfused_div = ns_per_op([&] { unfused.divide(q, one); }, iterations);
+    sink = q;
+
+    q = 1.0;
+    double const fused_div = ns_per_op([&] { fused.divide(q, one); }, iterations);
+    sink = q;
+
+    safe_float<double> sf_q(1.0);
+    double const library_div = ns_per_op([&] { sf_q /= sf_one; }, iterations);
+    sink = sf_q.get_stored_value();
+
+#ifdef FENV_AVAILABLE
+    std::printf("check_all<double>, FENV_AVAILABLE build\n");
+#else
+    std::printf("check_all<double>, software build\n");
+#endif
+    std::printf("%-10s %-10s %14s %12s\n", "operation", "path", "flag calls/op", "ns/op");
+    std::printf("%-10s %-10s %14d %12.2f\n", "addition", "raw", 0, raw_add);
+    std::printf("%-10s %-10s %14.0f %12.2f\n", "addition", "unfused", unfused_add_calls, unfused_add);
+    std::printf("%-10s %-10s %14.0f %12.2f\n", "addition", "fused", fused_add_calls, fused_add);
+    std::printf("%-10s %-10s %14s %12.2f\n", "addition", "safe_float", "-", library_add);
+    std::printf("%-10s %-10s %14.0f %12.2f\n", "division", "unfused", unfused_div_calls, unfused_div);
+    std::printf("%-10s %-10s %14.0f %12.2f\n", "division", "fused", fused_div_calls, fused_div);
+    std::printf("%-10s %-10s %14s %12.2f\n", "division", "safe_float", "-", library_div);
+    return 0;
+}
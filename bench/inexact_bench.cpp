@@ -0,0 +1,89 @@
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/convenience.hpp>
+
+using namespace boost::safe_float;
+
+/**
+  This benchmark compares the inexact checks computed with error-free transformations (check_inexact_rounding_eft)
+  with check_inexact_rounding, which uses the FE_INEXACT flag in the fenv build and round trips in the software build.
+  The operations are exact, no check fails.
+  */
+
+constexpr std::size_t size = 1024;
+constexpr long repetitions = 2000;
+
+template<class F>
+double ns_per_operation(F&& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < repetitions; ++i) f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / (repetitions * size);
+}
+
+template<class T>
+inline void opaque(T& value)
+{
+    __asm__ __volatile__("" : "+m"(value) : : "memory");
+}
+
+// out[i] = a[i] op b[i], T is FP or a safe_float
+template<class FP, class T>
+void run(const char* name, const char* type)
+{
+    std::vector<T> a, b, out(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        a.push_back(T(static_cast<FP>(1 + i % 7)));
+        b.push_back(T(static_cast<FP>(i % 2 ? 0.5 : 4)));
+    }
+    auto const apply = [&](auto op) {
+        return ns_per_operation([&] {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                T lhs = a[i];
+                op(lhs, b[i]);
+                out[i] = lhs;
+            }
+            opaque(out[0]);
+        });
+    };
+    double const add = apply([](T& l, const T& r) { l += r; });
+    double const sub = apply([](T& l, const T& r) { l -= r; });
+    double const mul = apply([](T& l, const T& r) { l *= r; });
+    double const div = apply([](T& l, const T& r) { l /= r; });
+    std::printf("%-12s %-12s %10.2f %10.2f %10.2f %10.2f\n", type, name, add, sub, mul, div);
+}
+
+template<class FP>
+void run_type(const char* type)
+{
+    run<FP, FP>("raw", type);
+#ifdef FENV_AVAILABLE
+    run<FP, safe_float<FP, policy::check_inexact_rounding>>("flags", type);
+#else
+    run<FP, safe_float<FP, policy::check_inexact_rounding>>("round trip", type);
+#endif
+    run<FP, safe_float<FP, policy::check_inexact_rounding_eft>>("eft", type);
+}
+
+int main()
+{
+#ifdef FENV_AVAILABLE
+    std::printf("inexact checks, fenv build, ns per operation over arrays\n");
+#else
+    std::printf("inexact checks, software build, ns per operation over arrays\n");
+#endif
+#ifndef FP_FAST_FMA
+    std::printf("FP_FAST_FMA is not defined, the double products errors use Dekker's product\n");
+#endif
+    std::printf("%-12s %-12s %10s %10s %10s %10s\n", "type", "check", "addition", "subtract", "multiply", "divide");
+    run_type<float>("float");
+    run_type<double>("double");
+    run_type<long double>("long double");
+    return 0;
+}
@@ -0,0 +1,53 @@
+#include <chrono>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/ingest.hpp>
+
+using namespace boost::safe_float;
+
+/**
+  This benchmark compares reading a CSV text of three columns into columns of safe_float<double> with a stream to
+  ingest::read_columns on one thread and on every hardware thread.
+  */
+
+constexpr std::size_t rows = 1000000;
+constexpr long repetitions = 3;
+
+template<class F>
+double ns_per_value(F&& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < repetitions; ++i) f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / (repetitions * rows * 3);
+}
+
+int main()
+{
+    std::string text;
+    for (std::size_t i = 0; i < rows; ++i)
+        text += std::to_string(i % 1000) + ".125," + std::to_string(i) + ",-" + std::to_string(i % 97) + ".5e-3\n";
+    std::vector<safe_float<double>> a(rows), b(rows), c(rows);
+    safe_float<double>* const columns[] = {a.data(), b.data(), c.data()};
+
+    double const stream = ns_per_value([&] {
+        std::istringstream in(text);
+        char comma;
+        for (std::size_t i = 0; i < rows; ++i) in >> a[i] >> comma >> b[i] >> comma >> c[i];
+    });
+    ingest::options single;
+    single.threads = 1;
+    double const one_thread = ns_per_value(
+        [&] { ingest::read_columns(text.data(), text.data() + text.size(), columns, 3, rows, single); });
+    double const all_threads =
+        ns_per_value([&] { ingest::read_columns(text.data(), text.data() + text.size(), columns, 3, rows); });
+
+    std::printf("CSV ingestion of %zu rows, ns per value\n", rows);
+    std::printf("%-12s %10s %10s %10s\n", "type", "iostream", "1 thread", "threads");
+    std::printf("%-12s %10.2f %10.2f %10.2f\n", "double", stream, one_thread, all_threads);
+    return 0;
+}
@@ -0,0 +1,152 @@
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/convenience.hpp>
+#include <boost/safe_float/linalg.hpp>
+
+using namespace boost::safe_float;
+
+/**
+  This benchmark compares the linear algebra kernels over arrays of safe_float<FP, check_bothflow> with the loops of
+  the safe_float operators and the same loops on raw FP values, in ns per multiply-add. No check fails.
+  */
+
+template<class F>
+double ns_per_multiply_add(std::size_t operations, long repetitions, F&& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < repetitions; ++i) f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / (repetitions * double(operations));
+}
+
+void print(const char* kernel, double loop, double raw, double kernels)
+{
+    std::printf("%-8s %10.3f %10.3f %10.3f %8.1fx\n", kernel, loop, raw, kernels, loop / kernels);
+}
+
+template<class FP>
+void run_all(const char* type)
+{
+    using SF = safe_float<FP, policy::check_bothflow>;
+    auto const values = [](std::size_t size, int seed) {
+        std::vector<SF> v;
+        for (std::size_t i = 0; i < size; ++i) v.push_back(SF(FP(int((i * 7 + seed) % 9) - 4) * FP(0.25)));
+        return v;
+    };
+    auto const raw = [](const std::vector<SF>& v) {
+        std::vector<FP> r;
+        for (const SF& s : v) r.push_back(s.get_stored_value());
+        return r;
+    };
+    std::printf("safe_float<%s, check_bothflow>, ns per multiply-add\n", type);
+    std::printf("%-8s %10s %10s %10s %9s\n", "kernel", "operators", "raw", "linalg", "speedup");
+
+    {
+        constexpr std::size_t size = 1 << 16;
+        constexpr long repetitions = 400;
+        auto const x = values(size, 1), y = values(size, 2);
+        auto const rx = raw(x), ry = raw(y);
+        FP volatile sink;
+        double const loop = ns_per_multiply_add(size, repetitions, [&] {
+            SF sum(FP(0));
+            for (std::size_t i = 0; i < size; ++i) sum += x[i] * y[i];
+            sink = sum.get_stored_value();
+        });
+        double const raw_loop = ns_per_multiply_add(size, repetitions, [&] {
+            FP sum = 0;
+            for (std::size_t i = 0; i < size; ++i) sum += rx[i] * ry[i];
+            sink = sum;
+        });
+        double const kernel = ns_per_multiply_add(
+            size, repetitions, [&] { sink = linalg::dot(x.data(), y.data(), size).get_stored_value(); });
+        (void)sink;
+        print("dot", loop, raw_loop, kernel);
+    }
+    {
+        constexpr std::size_t size = 1 << 16;
+        constexpr long repetitions = 400;
+        auto const x = values(size, 1);
+        auto y = values(size, 2);
+        auto rx = raw(x), ry = raw(y);
+        SF const a(FP(0.5));
+        // y is brought back to small values by the scale of -1
+        double const loop = ns_per_multiply_add(size, repetitions, [&, s = FP(1)]() mutable {
+            s = -s;
+            for (std::size_t i = 0; i < size; ++i) y[i] = SF(s) * a * x[i] + y[i];
+        });
+        double const raw_loop = ns_per_multiply_add(size, repetitions, [&, s = FP(1)]() mutable {
+            s = -s;
+            for (std::size_t i = 0; i < size; ++i) ry[i] = s * FP(0.5) * rx[i] + ry[i];
+        });
+        double const kernel = ns_per_multiply_add(size, repetitions, [&, s = FP(1)]() mutable {
+            s = -s;
+            linalg::axpy(SF(s * FP(0.5)), x.data(), y.data(), size);
+        });
+        print("axpy", loop, raw_loop, kernel);
+    }
+    {
+        constexpr std::size_t rows = 512, columns = 512;
+        constexpr long repetitions = 100;
+        auto const a = values(rows * columns, 1), x = values(columns, 2);
+        auto const ra = raw(a), rx = raw(x);
+        std::vector<SF> y(rows);
+        std::vector<FP> ry(rows);
+        double const loop = ns_per_multiply_add(rows * columns, repetitions, [&] {
+            for (std::size_t i = 0; i < rows; ++i)
+            {
+                SF sum(FP(0));
+                for (std::size_t j = 0; j < columns; ++j) sum += a[i * columns + j] * x[j];
+                y[i] = sum;
+            }
+        });
+        double const raw_loop = ns_per_multiply_add(rows * columns, repetitions, [&] {
+            for (std::size_t i = 0; i < rows; ++i)
+            {
+                FP sum = 0;
+                for (std::size_t j = 0; j < columns; ++j) sum += ra[i * columns + j] * rx[j];
+                ry[i] = sum;
+            }
+        });
+        double const kernel = ns_per_multiply_add(rows * columns, repetitions,
+                                                  [&] { linalg::gemv(a.data(), x.data(), y.data(), rows, columns); });
+        print("gemv", loop, raw_loop, kernel);
+    }
+    {
+        constexpr std::size_t n = 256;
+        constexpr long repetitions = 4;
+        auto const a = values(n * n, 1), b = values(n * n, 2);
+        auto const ra = raw(a), rb = raw(b);
+        std::vector<SF> c(n * n);
+        std::vector<FP> rc(n * n);
+        // the naive triple loop
+        double const loop = ns_per_multiply_add(n * n * n, repetitions, [&] {
+            for (std::size_t i = 0; i < n; ++i)
+                for (std::size_t j = 0; j < n; ++j)
+                {
+                    SF sum(FP(0));
+                    for (std::size_t p = 0; p < n; ++p) sum += a[i * n + p] * b[p * n + j];
+                    c[i * n + j] = sum;
+                }
+        });
+        // the loop order vectorized by the compiler
+        double const raw_loop = ns_per_multiply_add(n * n * n, repetitions, [&] {
+            std::fill(rc.begin(), rc.end(), FP(0));
+            for (std::size_t i = 0; i < n; ++i)
+                for (std::size_t p = 0; p < n; ++p)
+                    for (std::size_t j = 0; j < n; ++j) rc[i * n + j] += ra[i * n + p] * rb[p * n + j];
+        });
+        double const kernel =
+            ns_per_multiply_add(n * n * n, repetitions, [&] { linalg::gemm(a.data(), b.data(), c.data(), n, n, n); });
+        print("gemm", loop, raw_loop, kernel);
+    }
+}
+
+int main()
+{
+    run_all<float>("float");
+    run_all<double>("double");
+    return 0;
+}
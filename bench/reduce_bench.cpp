@@ -0,0 +1,59 @@
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/convenience.hpp>
+#include <boost/safe_float/reduce.hpp>
+
+using namespace boost::safe_float;
+
+/**
+  This benchmark compares the sum of a vector of safe_float<double, check_bothflow> by std::accumulate to reduce on
+  one thread and on every hardware thread, and to std::reduce of the same values as double without checks.
+  */
+
+constexpr std::size_t size = 1 << 24;
+constexpr long repetitions = 20;
+
+template<class F>
+double ns_per_value(F&& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < repetitions; ++i) f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / (repetitions * size);
+}
+
+int main()
+{
+    using sf = safe_float<double, policy::check_bothflow>;
+    std::vector<sf> values;
+    std::vector<double> raw;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        values.emplace_back(double(i % 1000) * 0.125);
+        raw.push_back(double(i % 1000) * 0.125);
+    }
+    double volatile sink;
+
+    double const accumulate =
+        ns_per_value([&] { sink = std::accumulate(values.begin(), values.end(), sf(0.)).get_stored_value(); });
+    double const raw_reduce = ns_per_value([&] { sink = std::reduce(raw.begin(), raw.end(), 0.); });
+    reduction::options single;
+    single.threads = 1;
+    double const one_thread = ns_per_value([&] {
+        sink = boost::safe_float::reduce(values.begin(), values.end(), sf(0.), std::plus<>(), single).get_stored_value();
+    });
+    double const all_threads = ns_per_value(
+        [&] { sink = boost::safe_float::reduce(values.begin(), values.end(), sf(0.), std::plus<>()).get_stored_value(); });
+    (void)sink;
+
+    std::printf("Sum of %zu values on %u hardware threads, ns per value\n", size, std::thread::hardware_concurrency());
+    std::printf("%-12s %12s %12s %12s %12s\n", "type", "accumulate", "std::reduce", "1 thread", "threads");
+    std::printf("%-12s %12.3f %12.3f %12.3f %12.3f\n", "double", accumulate, raw_reduce, one_thread, all_threads);
+    return 0;
+}
@@ -0,0 +1,275 @@
+#include <chrono>
+#include <cstdio>
+#include <type_traits>
+#include <vector>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/convenience.hpp>
+
+using namespace boost::safe_float;
+
+/**
+  This benchmark measures the cost of safe_float against the raw FP for every operation, every policy of
+  convenience.hpp and float, double and long double, with three access patterns:
+  - scalar: one operation on values the compiler cannot see, the overhead of an isolated operation
+  - chain: every result is the left operand of the next operation, the latency added to a dependent computation
+  - array: out[i] = a[i] op b[i] over arrays, the throughput of independent operations the compiler may vectorize
+  The results are written as JSON to the standard output, or to the file given as first argument. The values are
+  chosen to keep every operation exact and in range, no check fails.
+  */
+
+#ifdef FENV_AVAILABLE
+constexpr const char* build = "fenv";
+#else
+constexpr const char* build = "software";
+#endif
+
+constexpr std::size_t array_size = 1024;
+constexpr long operations = 1L << 20;
+constexpr int runs = 3;
+
+// Keeps value in memory, the compiler forgets what it knows about it
+template<class T>
+inline void opaque(T& value)
+{
+    __asm__ __volatile__("" : "+m"(value) : : "memory");
+}
+
+struct addition
+{
+    static constexpr const char* name = "addition";
+    template<class T>
+    static void apply(T& lhs, const T& rhs) { lhs += rhs; }
+    // chain operands, the accumulator alternates between two values
+    static constexpr double chain_even = 1, chain_odd = -1;
+};
+
+struct subtraction
+{
+    static constexpr const char* name = "subtraction";
+    template<class T>
+    static void apply(T& lhs, const T& rhs) { lhs -= rhs; }
+    static constexpr double chain_even = 1, chain_odd = -1;
+};
+
+struct multiplication
+{
+    static constexpr const char* name = "multiplication";
+    template<class T>
+    static void apply(T& lhs, const T& rhs) { lhs *= rhs; }
+    static constexpr double chain_even = 2, chain_odd = 0.5;
+};
+
+struct division
+{
+    static constexpr const char* name = "division";
+    template<class T>
+    static void apply(T& lhs, const T& rhs) { lhs /= rhs; }
+    static constexpr double chain_even = 2, chain_odd = 0.5;
+};
+
+// Best time of the runs, in ns per operation
+template<class F>
+double ns_per_operation(F&& f, long count)
+{
+    double best = 0;
+    for (int run = 0; run < runs; ++run)
+    {
+        auto start = std::chrono::steady_clock::now();
+        f();
+        auto stop = std::chrono::steady_clock::now();
+        double const ns = std::chrono::duration<double, std::nano>(stop - start).count() / count;
+        if (run == 0 || ns < best) best = ns;
+    }
+    return best;
+}
+
+// T is FP or a safe_float of FP, the operands are powers of 2 and small integers
+template<class FP, class T, class OPERATION>
+double scalar(const std::vector<T>& a, const std::vector<T>& b)
+{
+    T sink{};
+    double const ns = ns_per_operation(
+        [&] {
+            for (long i = 0; i < operations; ++i)
+            {
+                T lhs = a[i % 16], rhs = b[i % 16];
+                opaque(lhs);
+                opaque(rhs);
+                OPERATION::apply(lhs, rhs);
+                opaque(lhs);
+                sink = lhs;
+            }
+        },
+        operations);
+    opaque(sink);
+    return ns;
+}
+
+template<class FP, class T, class OPERATION>
+double chain(const std::vector<T>&, const std::vector<T>&)
+{
+    T const even(static_cast<FP>(OPERATION::chain_even)), odd(static_cast<FP>(OPERATION::chain_odd));
+    T acc(static_cast<FP>(1));
+    double const ns = ns_per_operation(
+        [&] {
+            for (long i = 0; i < operations; i += 2)
+            {
+                OPERATION::apply(acc, even);
+                OPERATION::apply(acc, odd);
+            }
+        },
+        operations);
+    opaque(acc);
+    return ns;
+}
+
+template<class FP, class T, class OPERATION>
+double array(const std::vector<T>& a, const std::vector<T>& b)
+{
+    std::vector<T> out(array_size);
+    double const ns = ns_per_operation(
+        [&] {
+            for (long pass = 0; pass < operations / static_cast<long>(array_size); ++pass)
+            {
+                for (std::size_t i = 0; i < array_size; ++i)
+                {
+                    T lhs = a[i];
+                    OPERATION::apply(lhs, b[i]);
+                    out[i] = lhs;
+                }
+                opaque(out[pass % array_size]);
+            }
+        },
+        operations);
+    opaque(out[0]);
+    return ns;
+}
+
+class json_writer
+{
+public:
+    explicit json_writer(std::FILE* f) : out(f)
+    {
+        std::fprintf(out, "{\n  \"build\": \"%s\",\n  \"results\": [", build);
+    }
+    ~json_writer() { std::fprintf(out, "\n  ]\n}\n"); }
+
+    void result(const char* type, const char* policy, const char* operation, const char* pattern, double ns,
+                double raw_ns)
+    {
+        std::fprintf(out,
+                     "%s\n    {\"type\": \"%s\", \"policy\": \"%s\", \"operation\": \"%s\", \"pattern\": \"%s\", "
+                     "\"ns_per_op\": %.3f, \"relative_to_raw\": %.2f}",
+                     first ? "" : ",", type, policy, operation, pattern, ns, ns / raw_ns);
+        first = false;
+    }
+
+private:
+    std::FILE* out;
+    bool first = true;
+};
+
+struct raw_float
+{
+    static constexpr const char* name = "raw";
+};
+
+template<class FP, class POLICY>
+struct operand
+{
+    using type = safe_float<FP, POLICY::template check>;
+};
+
+template<class FP>
+struct operand<FP, raw_float>
+{
+    using type = FP;
+};
+
+#define BOOST_SAFE_FLOAT_BENCH_POLICY(NAME)        \
+    struct bench_##NAME                            \
+    {                                              \
+        static constexpr const char* name = #NAME; \
+        template<class FP>                         \
+        using check = policy::NAME<FP>;            \
+    };
+
+BOOST_SAFE_FLOAT_BENCH_POLICY(check_overflow)
+BOOST_SAFE_FLOAT_BENCH_POLICY(check_underflow)
+BOOST_SAFE_FLOAT_BENCH_POLICY(check_inexact_rounding)
+BOOST_SAFE_FLOAT_BENCH_POLICY(check_inexact_rounding_eft)
+BOOST_SAFE_FLOAT_BENCH_POLICY(check_invalid_result)
+BOOST_SAFE_FLOAT_BENCH_POLICY(check_finite)
+BOOST_SAFE_FLOAT_BENCH_POLICY(check_all)
+
+#undef BOOST_SAFE_FLOAT_BENCH_POLICY
+
+template<class FP, class OPERATION>
+struct pattern_runner
+{
+    const char* type;
+    json_writer& json;
+    double raw_ns[3];
+
+    template<class POLICY>
+    void run()
+    {
+        using T = typename operand<FP, POLICY>::type;
+        std::vector<T> a, b;
+        for (std::size_t i = 0; i < array_size; ++i)
+        {
+            a.push_back(T(static_cast<FP>(1 << (i % 4))));
+            b.push_back(T(static_cast<FP>(i % 3 == 0 ? 0.5 : static_cast<double>(1 << (i % 3)))));
+        }
+        double const ns[3] = {scalar<FP, T, OPERATION>(a, b), chain<FP, T, OPERATION>(a, b),
+                              array<FP, T, OPERATION>(a, b)};
+        const char* const patterns[3] = {"scalar", "chain", "array"};
+        for (int p = 0; p < 3; ++p)
+        {
+            if (std::is_same<POLICY, raw_float>::value) raw_ns[p] = ns[p];
+            json.result(type, POLICY::name, OPERATION::name, patterns[p], ns[p], raw_ns[p]);
+        }
+    }
+};
+
+template<class FP, class OPERATION>
+void run_operation(const char* type, json_writer& json)
+{
+    pattern_runner<FP, OPERATION> runner{type, json, {}};
+    runner.template run<raw_float>();
+    runner.template run<bench_check_overflow>();
+    runner.template run<bench_check_underflow>();
+    runner.template run<bench_check_inexact_rounding>();
+    runner.template run<bench_check_inexact_rounding_eft>();
+    runner.template run<bench_check_invalid_result>();
+    runner.template run<bench_check_finite>();
+    runner.template run<bench_check_all>();
+}
+
+template<class FP>
+void run_type(const char* type, json_writer& json)
+{
+    run_operation<FP, addition>(type, json);
+    run_operation<FP, subtraction>(type, json);
+    run_operation<FP, multiplication>(type, json);
+    run_operation<FP, division>(type, json);
+}
+
+int main(int argc, char* argv[])
+{
+    std::FILE* out = argc > 1 ? std::fopen(argv[1], "w") : stdout;
+    if (!out)
+    {
+        std::fprintf(stderr, "cannot open %s\n", argv[1]);
+        return 1;
+    }
+    {
+        json_writer json(out);
+        run_type<float>("float", json);
+        run_type<double>("double", json);
+        run_type<long double>("long double", json);
+    }
+    if (out != stdout) std::fclose(out);
+    return 0;
+}
@@ -0,0 +1,91 @@
+#include <chrono>
+#include <cstdio>
+#include <type_traits>
+#include <vector>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/convenience.hpp>
+#include <boost/safe_float/simd.hpp>
+
+using namespace boost::safe_float;
+
+/**
+  This benchmark compares a multiply-add over arrays computed with raw double, with safe_float and with safe_simd.
+  */
+
+template<typename F>
+double ns_per_element(F&& f, long repetitions, std::size_t size)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < repetitions; ++i) f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / (repetitions * size);
+}
+
+template<template<typename> typename CHECK>
+void run(const char* name, const std::vector<double>& x, long repetitions, volatile double& sink)
+{
+    std::size_t const size = x.size();
+    std::vector<safe_float<double, CHECK>> sx(x.begin(), x.end()), sy(size);
+    safe_float<double, CHECK> const a(1.5);
+    double scalar = ns_per_element(
+        [&] {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                safe_float<double, CHECK> t = a;
+                t *= sx[i];
+                t += sy[i];
+                sy[i] = t;
+            }
+        },
+        repetitions, size);
+    sink = sy[size / 2].get_stored_value();
+
+    std::vector<safe_float<double, CHECK>> vy(size);
+    auto run_lanes = [&](auto lanes) {
+        using simd = safe_simd<double, decltype(lanes)::value, CHECK>;
+        simd const va(1.5);
+        return ns_per_element(
+            [&] {
+                for (std::size_t i = 0; i < size; i += simd::size())
+                    (va * simd::load(&sx[i]) + simd::load(&vy[i])).store(&vy[i]);
+            },
+            repetitions, size);
+    };
+    double simd2 = run_lanes(std::integral_constant<std::size_t, 2>{});
+    double simd4 = run_lanes(std::integral_constant<std::size_t, 4>{});
+    double simd8 = run_lanes(std::integral_constant<std::size_t, 8>{});
+    sink = vy[size / 2].get_stored_value();
+    std::printf("%-20s %12.2f %12.2f %12.2f %12.2f\n", name, scalar, simd2, simd4, simd8);
+}
+
+int main()
+{
+    constexpr std::size_t size = 4096;
+    constexpr long repetitions = 5000;
+
+    volatile double sink = 0;
+    std::vector<double> x(size);
+    for (std::size_t i = 0; i < size; ++i) x[i] = 1.0 + i % 7;
+
+#ifdef FENV_AVAILABLE
+    std::printf("y = 1.5 * x + y, FE_* flags checks, ns per element\n");
+#else
+    std::printf("y = 1.5 * x + y, software checks, ns per element\n");
+#endif
+    std::printf("%-20s %12s %12s %12s %12s\n", "policy", "safe_float", "simd x2", "simd x4", "simd x8");
+
+    std::vector<double> y(size);
+    double raw = ns_per_element(
+        [&] {
+            for (std::size_t i = 0; i < size; ++i) y[i] = 1.5 * x[i] + y[i];
+        },
+        repetitions, size);
+    sink = y[size / 2];
+    std::printf("%-20s %12.2f\n", "raw double", raw);
+
+    run<policy::check_overflow>("overflow", x, repetitions, sink);
+    run<policy::check_invalid_result>("invalid_result", x, repetitions, sink);
+    run<policy::check_all>("all", x, repetitions, sink);
+    return 0;
+}
@@ -0,0 +1,95 @@
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/convenience.hpp>
+#include <boost/safe_float/sparse.hpp>
+
+using namespace boost::safe_float;
+
+/**
+  This benchmark compares the product of synthetic sparse matrices of safe_float<double, check_overflow> by a vector
+  computed by the loop of the safe_float operators, by the same loop on raw double values and by spmv on one thread
+  and on every hardware thread, in ns per nonzero. The matrices have the same number of rows and a growing number of
+  nonzeros per row, at random columns. No check fails.
+  */
+
+constexpr std::size_t size = 1 << 15;
+
+template<class F>
+double ns_per_nonzero(std::size_t nonzeros, long repetitions, F&& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < repetitions; ++i) f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / (repetitions * double(nonzeros));
+}
+
+int main()
+{
+    using sf = safe_float<double, policy::check_overflow>;
+    std::mt19937_64 random(42);
+    std::uniform_int_distribution<std::size_t> column(0, size - 1);
+    std::uniform_real_distribution<double> value(-1., 1.);
+    std::vector<sf> x;
+    for (std::size_t i = 0; i < size; ++i) x.emplace_back(value(random));
+    std::vector<sf> y(size);
+    std::vector<double> ry(size);
+    double volatile sink;
+
+    std::printf("%zu x %zu matrices on %u hardware threads, ns per nonzero\n", size, size,
+                std::thread::hardware_concurrency());
+    std::printf("%-10s %10s %10s %10s %10s %10s\n", "density", "nonzeros", "operators", "raw", "1 thread", "threads");
+    for (std::size_t per_row : {4, 16, 64, 256})
+    {
+        std::vector<std::size_t> offsets{0}, indices;
+        std::vector<sf> values;
+        for (std::size_t r = 0; r < size; ++r)
+        {
+            for (std::size_t i = 0; i < per_row; ++i)
+            {
+                indices.push_back(column(random));
+                values.emplace_back(value(random));
+            }
+            offsets.push_back(values.size());
+        }
+        sparse::csr_matrix<sf> const a(size, size, offsets, indices, values);
+        std::vector<double> raw_values;
+        for (const sf& v : values) raw_values.push_back(v.get_stored_value());
+        std::vector<double> raw_x;
+        for (const sf& v : x) raw_x.push_back(v.get_stored_value());
+
+        std::size_t const nonzeros = a.nonzeros();
+        long const repetitions = long((std::size_t(1) << 27) / nonzeros);
+        double const loop = ns_per_nonzero(nonzeros, repetitions, [&] {
+            for (std::size_t r = 0; r < size; ++r)
+            {
+                sf sum(0.);
+                for (std::size_t i = offsets[r]; i < offsets[r + 1]; ++i) sum += values[i] * x[indices[i]];
+                y[r] = sum;
+            }
+            sink = y[0].get_stored_value();
+        });
+        double const raw = ns_per_nonzero(nonzeros, repetitions, [&] {
+            for (std::size_t r = 0; r < size; ++r)
+            {
+                double sum = 0;
+                for (std::size_t i = offsets[r]; i < offsets[r + 1]; ++i) sum += raw_values[i] * raw_x[indices[i]];
+                ry[r] = sum;
+            }
+            sink = ry[0];
+        });
+        sparse::options single;
+        single.threads = 1;
+        double const one_thread =
+            ns_per_nonzero(nonzeros, repetitions, [&] { sparse::spmv(a, x.data(), y.data(), single); });
+        double const all_threads = ns_per_nonzero(nonzeros, repetitions, [&] { sparse::spmv(a, x.data(), y.data()); });
+        std::printf("%-10.5f %10zu %10.3f %10.3f %10.3f %10.3f\n", double(per_row) / size, nonzeros, loop, raw,
+                    one_thread, all_threads);
+    }
+    (void)sink;
+    return 0;
+}
@@ -0,0 +1,68 @@
+#include <chrono>
+#include <cstdio>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/convenience.hpp>
+#include <boost/safe_float/trap.hpp>
+
+using namespace boost::safe_float;
+
+/**
+  This benchmark compares checking by hardware traps against the checks done in the operators, FE_* flags in the
+  FENV_AVAILABLE build and software checks otherwise.
+  */
+
+template<typename F>
+double ns_per_op(F&& f, long iterations)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < iterations; ++i) f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / iterations;
+}
+
+template<template<typename> typename CHECK>
+void run(const char* name, double one, long iterations, volatile double& sink)
+{
+    safe_float<double, CHECK> acc(0.0), q(1.0), rhs(one);
+    double add = ns_per_op([&] { acc += rhs; }, iterations);
+    double div = ns_per_op([&] { q /= rhs; }, iterations);
+    sink = acc.get_stored_value() + q.get_stored_value();
+    std::printf("%-20s %12.2f %12.2f\n", name, add, div);
+}
+
+int main()
+{
+    constexpr long iterations = 10000000;
+
+    volatile double sink = 0;
+    // kept opaque so the compiler cannot fold the operations away
+    double const one = sink + 1.0;
+
+#ifdef FENV_AVAILABLE
+    const char* checks = "FE_* flags";
+#else
+    const char* checks = "software";
+#endif
+#ifdef BOOST_SAFE_FLOAT_HAS_FPE_TRAPS
+    const char* traps = "hardware traps";
+#else
+    const char* traps = "no hardware traps, sticky flags";
+#endif
+    std::printf("%s checks, %s\n", checks, traps);
+    std::printf("%-20s %12s %12s\n", "policy", "add ns/op", "div ns/op");
+
+    double raw_acc = 0.0, raw_q = 1.0;
+    double raw_add = ns_per_op([&] { raw_acc += one; }, iterations);
+    double raw_div = ns_per_op([&] { raw_q /= one; }, iterations);
+    sink = raw_acc + raw_q;
+    std::printf("%-20s %12.2f %12.2f\n", "raw double", raw_add, raw_div);
+
+    {
+        trap_scope<> scope;
+        run<policy::trapped<>::policy>("trapped", one, iterations, sink);
+    }
+    run<policy::check_overflow>("check_overflow", one, iterations, sink);
+    run<policy::check_all>("check_all", one, iterations, sink);
+    return 0;
+}
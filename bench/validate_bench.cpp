@@ -0,0 +1,56 @@
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include <boost/safe_float/policy/classify.hpp>
+#include <boost/safe_float/validate.hpp>
+
+using namespace boost::safe_float;
+
+/**
+  This benchmark compares the validation of an array of finite values by validation::validate with a loop testing
+  every value with the policy::classify functions, as a loop converting the values one by one does.
+  */
+
+constexpr std::size_t size = 1 << 16;
+constexpr long repetitions = 2000;
+
+template<class F>
+double ns_per_value(F&& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < repetitions; ++i) f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / (repetitions * size);
+}
+
+template<class FP>
+void run(const char* type, volatile std::size_t& sink)
+{
+    std::vector<FP> values;
+    for (std::size_t i = 0; i < size; ++i) values.push_back(FP(i) / 3 + 1);
+    namespace classify = policy::classify;
+    double const loop = ns_per_value([&] {
+        std::size_t first = size;
+        for (std::size_t i = 0; i < size; ++i)
+            if (!classify::is_finite(values[i]) || classify::is_subnormal(values[i]))
+            {
+                first = i;
+                break;
+            }
+        sink = first;
+    });
+    double const scan = ns_per_value([&] { sink = validation::validate(values.data(), size, validation::all).index; });
+    std::printf("%-12s %10.3f %10.3f\n", type, loop, scan);
+}
+
+int main()
+{
+    volatile std::size_t sink = 0;
+    std::printf("validation of finite values, ns per value\n");
+    std::printf("%-12s %10s %10s\n", "type", "classify", "validate");
+    run<float>("float", sink);
+    run<double>("double", sink);
+    run<long double>("long double", sink);
+    return 0;
+}
@@ -0,0 +1,12 @@
+// float and double operations raise their flags in MXCSR only when they are computed with SSE
+#include <xmmintrin.h>
+
+#if !defined(__SSE2_MATH__)
+#error "float and double are not computed with SSE"
+#endif
+
+int main()
+{
+    _mm_setcsr(_mm_getcsr() & ~0x3fu);
+    return 0;
+}
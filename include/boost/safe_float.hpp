@@ -2,9 +2,13 @@
 #define BOOST_SAFE_FLOAT_HPP
 
 #include <iostream>
+#include <limits>
+#include <string>
 
 #include <boost/safe_float/convenience.hpp>
+#include <boost/safe_float/fp_traits.hpp>
 #include <boost/safe_float/policy/on_fail_throw.hpp>
+#include <boost/safe_float/policy/fenv_flags.hpp>
 
 
 namespace boost
@@ -19,8 +23,8 @@ class safe_float : private CHECK<FP>, ERROR_HANDLING
     
     using pol = CHECK<FP>;
     using traits = policy::policy_traits<FP, CHECK<FP>>;
-    pol& policy() noexcept { return static_cast<pol&>(*this); }
-    ERROR_HANDLING& handler() noexcept { return static_cast<ERROR_HANDLING&>(*this); }
+    constexpr pol& policy() noexcept { return static_cast<pol&>(*this); }
+    constexpr ERROR_HANDLING& handler() noexcept { return static_cast<ERROR_HANDLING&>(*this); }
 
 public:
     
@@ -29,10 +33,10 @@ public:
     using report_policy = ERROR_HANDLING;
     using cast_policy = CAST<safe_float>;
     
-    static_assert(std::is_floating_point<FP>::value,
-                  "First template parameter in safe_float has to be floating point data type");
+    static_assert(is_floating_point_type<FP>,
+                  "First template parameter in safe_float has to be floating point data type, see fp_traits");
 
-    safe_float() : safe_float((FP)0.0f) {}
+    constexpr safe_float() : safe_float((FP)0.0f) {}
 
     // Explicit constructor for FP in case the cast policy doesn't allow construction already
     template<
@@ -42,82 +46,130 @@ public:
                 FP,
                 OtherFP> && !CAST<safe_float>::template can_explicitly_cast_from<OtherFP> && !CAST<safe_float>::template can_cast_from<OtherFP>,
             int> = 0>
-    explicit safe_float(OtherFP f) : number{f}
+    constexpr explicit safe_float(OtherFP f) : number{f}
     {}
 
     // Explicit constructors available through the cast policy
     template<typename T, std::enable_if_t<CAST<safe_float>::template can_explicitly_cast_from<T>, int> = 0>
-    explicit safe_float(T source)
+    constexpr explicit safe_float(T source) : number{}
     {
         policy::cast_helper<FP, CAST<safe_float>>::template construct_explicitly(number, source);
     }
 
     // Implicit constructors available through the cast policy
     template<typename T, std::enable_if_t<CAST<safe_float>::template can_cast_from<T>, int> = 0>
-    safe_float(T source)
+    constexpr safe_float(T source) : number{}
     {
         policy::cast_helper<FP, CAST<safe_float>>::template construct_implicitly(number, source);
     }
 
     // Conversion operators
     template<typename T, std::enable_if_t<CAST<safe_float>::template can_cast_to<T>, int> = 0>
-    operator T () {
+    constexpr operator T () {
         return policy::cast_helper<FP, CAST<safe_float>>::template convert_implicitly<T>(number);
     }
 
     template<typename T, std::enable_if_t<CAST<safe_float>::template can_explicitly_cast_to<T>, int> = 0>
-    explicit operator T () {
+    constexpr explicit operator T () {
         return policy::cast_helper<FP, CAST<safe_float>>::template convert_explicitly<T>(number);
     }
     
 
+    // Evaluation of an expression template (see expression.hpp), the whole expression is checked at once
+    template<typename E, std::enable_if_t<std::is_same_v<typename E::safe_float_type, safe_float>, int> = 0>
+    safe_float(const E& e) : number(e.evaluate(handler()))
+    {}
+
+    template<typename E, std::enable_if_t<std::is_same_v<typename E::safe_float_type, safe_float>, int> = 0>
+    safe_float& operator=(const E& e)
+    {
+        number = e.evaluate(handler());
+        return *this;
+    }
+
     // Access to internal representation
-    FP get_stored_value() const { return number; }
-    void set_stored_value(FP f) { number = f; }
+    constexpr FP get_stored_value() const { return number; }
+    constexpr void set_stored_value(FP f) { number = f; }
 
-    // unary arithmetic operators implementation
-    safe_float<FP, CHECK, ERROR_HANDLING, CAST>& operator+=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
+    // Reports a failure that is not an operation's, like a parse error, to the handler of this safe_float
+    void report_failure(const std::string& message) { handler().report_failure(message); }
+
+    // unary arithmetic operators implementation, a check failing in a constant expression is a compile error
+    constexpr safe_float<FP, CHECK, ERROR_HANDLING, CAST>&
+    operator+=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
     {
-        traits::report_pre_addition(policy(), number, rhs.number, handler()); // early error detection
-        number += rhs.number;
-        traits::report_post_addition(policy(), number, handler());
+        FP lhs = number, r = rhs.number;
+        traits::report_pre_addition(policy(), lhs, r, handler()); // early error detection
+        policy::fenv_flags::fence<FP>(lhs, r);
+        number = lhs + r;
+        policy::fenv_flags::fence<FP>(number);
+        traits::report_post_addition(policy(), lhs, r, number, handler());
         return *this;
     }
 
-    safe_float<FP, CHECK, ERROR_HANDLING, CAST>& operator-=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
+    constexpr safe_float<FP, CHECK, ERROR_HANDLING, CAST>&
+    operator-=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
     {
-        traits::report_pre_subtraction(policy(), number, rhs.number, handler()); // early error detection
-        number -= rhs.number;
-        traits::report_post_subtraction(policy(), number, handler());
+        FP lhs = number, r = rhs.number;
+        traits::report_pre_subtraction(policy(), lhs, r, handler()); // early error detection
+        policy::fenv_flags::fence<FP>(lhs, r);
+        number = lhs - r;
+        policy::fenv_flags::fence<FP>(number);
+        traits::report_post_subtraction(policy(), lhs, r, number, handler());
         return *this;
     }
 
-    safe_float<FP, CHECK, ERROR_HANDLING, CAST>& operator*=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
+    constexpr safe_float<FP, CHECK, ERROR_HANDLING, CAST>&
+    operator*=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
     {
-        traits::report_pre_multiplication(policy(), number, rhs.number, handler()); // early error detection
-        number *= rhs.number;
-        traits::report_post_multiplication(policy(), number, handler());
+        FP lhs = number, r = rhs.number;
+        traits::report_pre_multiplication(policy(), lhs, r, handler()); // early error detection
+        policy::fenv_flags::fence<FP>(lhs, r);
+        number = lhs * r;
+        policy::fenv_flags::fence<FP>(number);
+        traits::report_post_multiplication(policy(), lhs, r, number, handler());
         return *this;
     }
 
-    safe_float<FP, CHECK, ERROR_HANDLING, CAST>& operator/=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
+    constexpr safe_float<FP, CHECK, ERROR_HANDLING, CAST>&
+    operator/=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
     {
-        traits::report_pre_division(policy(), number, rhs.number, handler()); // early error detection
-        number /= rhs.number;
-        traits::report_post_division(policy(), number, handler());
+        FP lhs = number, r = rhs.number;
+        traits::report_pre_division(policy(), lhs, r, handler()); // early error detection
+        policy::fenv_flags::fence<FP>(lhs, r);
+        number = lhs / r;
+        policy::fenv_flags::fence<FP>(number);
+        traits::report_post_division(policy(), lhs, r, number, handler());
         return *this;
     }
 
     // unary negative operator
-    safe_float<FP, CHECK, ERROR_HANDLING, CAST> operator-() const
+    constexpr safe_float<FP, CHECK, ERROR_HANDLING, CAST> operator-() const
     {
         return safe_float<FP, CHECK, ERROR_HANDLING, CAST>(-number);
     }
 };
 
+// Stateless policies are empty bases, so the default safe_float can be used in place of its FP in arrays
+static_assert(sizeof(safe_float<float>) == sizeof(float) && std::is_standard_layout_v<safe_float<float>>,
+              "safe_float<float> is expected to have the layout of float");
+static_assert(sizeof(safe_float<double>) == sizeof(double) && std::is_standard_layout_v<safe_float<double>>,
+              "safe_float<double> is expected to have the layout of double");
+
 // binary arithmetic operators
+#ifdef BOOST_SAFE_FLOAT_EXPRESSION_TEMPLATES
+} // namespace safe_float
+} // namespace boost
+
+#include <boost/safe_float/expression.hpp>
+
+namespace boost
+{
+namespace safe_float
+{
+#else
 template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
-inline safe_float<FP, CHECK, ERROR_HANDLING, CAST> operator+(safe_float<FP, CHECK, ERROR_HANDLING, CAST> lhs,
+constexpr safe_float<FP, CHECK, ERROR_HANDLING, CAST> operator+(safe_float<FP, CHECK, ERROR_HANDLING, CAST> lhs,
                                                              const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
 {
     lhs += rhs;
@@ -125,7 +177,7 @@ inline safe_float<FP, CHECK, ERROR_HANDLING, CAST> operator+(safe_float<FP, CHEC
 }
 
 template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
-inline safe_float<FP, CHECK, ERROR_HANDLING, CAST> operator-(safe_float<FP, CHECK, ERROR_HANDLING, CAST> lhs,
+constexpr safe_float<FP, CHECK, ERROR_HANDLING, CAST> operator-(safe_float<FP, CHECK, ERROR_HANDLING, CAST> lhs,
                                                              const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
 {
     lhs -= rhs;
@@ -133,7 +185,7 @@ inline safe_float<FP, CHECK, ERROR_HANDLING, CAST> operator-(safe_float<FP, CHEC
 }
 
 template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
-inline safe_float<FP, CHECK, ERROR_HANDLING, CAST> operator*(safe_float<FP, CHECK, ERROR_HANDLING, CAST> lhs,
+constexpr safe_float<FP, CHECK, ERROR_HANDLING, CAST> operator*(safe_float<FP, CHECK, ERROR_HANDLING, CAST> lhs,
                                                              const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
 {
     lhs *= rhs;
@@ -141,59 +193,60 @@ inline safe_float<FP, CHECK, ERROR_HANDLING, CAST> operator*(safe_float<FP, CHEC
 }
 
 template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
-inline safe_float<FP, CHECK, ERROR_HANDLING, CAST> operator/(safe_float<FP, CHECK, ERROR_HANDLING, CAST> lhs,
+constexpr safe_float<FP, CHECK, ERROR_HANDLING, CAST> operator/(safe_float<FP, CHECK, ERROR_HANDLING, CAST> lhs,
                                                              const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
 {
     lhs /= rhs;
     return lhs;
 }
+#endif
 
 // comparison operators
 template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
-inline bool operator<(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& lhs,
-                      const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
+constexpr bool operator<(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& lhs,
+                         const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
 {
     return lhs.get_stored_value() < rhs.get_stored_value();
 }
 
 template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
-inline bool operator>(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& lhs,
-                      const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
+constexpr bool operator>(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& lhs,
+                         const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
 {
     return rhs < lhs;
 }
 
 template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
-inline bool operator<=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& lhs,
-                       const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
+constexpr bool operator<=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& lhs,
+                          const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
 {
     return !(lhs > rhs);
 }
 
 template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
-inline bool operator>=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& lhs,
-                       const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
+constexpr bool operator>=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& lhs,
+                          const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
 {
     return !(lhs < rhs);
 }
 
 template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
-inline bool operator==(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& lhs,
-                       const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
+constexpr bool operator==(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& lhs,
+                          const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
 {
     return lhs.get_stored_value() == rhs.get_stored_value();
 }
 
 template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
-inline bool operator!=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& lhs,
-                       const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
+constexpr bool operator!=(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& lhs,
+                          const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& rhs)
 {
     return !(lhs == rhs);
 }
 
 // iostream operators
 template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
-inline std::ostream& operator<<(std::ostream& out, safe_float<FP, CHECK, ERROR_HANDLING, CAST>& sf)
+inline std::ostream& operator<<(std::ostream& out, const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& sf)
 {
     out << sf.get_stored_value();
     return out;
@@ -204,7 +257,11 @@ inline std::istream& operator>>(std::istream& in, safe_float<FP, CHECK, ERROR_HA
 {
     FP number;
     in >> number;
-    sf.set_stored_value(number);
+    // the stream stores the largest finite value and fails when the number read is out of range, see also from_chars
+    if (in.fail() && (number == std::numeric_limits<FP>::max() || number == std::numeric_limits<FP>::lowest()))
+        sf.report_failure("Floating point number out of range");
+    else if (!in.fail())
+        sf.set_stored_value(number);
     return in;
 }
 
@@ -241,44 +298,49 @@ public:
     static constexpr bool traps = std::numeric_limits<FP>::traps;
     static constexpr bool tinyness_before = std::numeric_limits<FP>::tinyness_before;
 
-    static constexpr bool is_exact = std::numeric_limits<FP>::is_exact;           // TODO: check for inexact policies
+    // a safe_float only checking the rounding of every operation is exact, the ones checking other failures as well
+    // keep the limits of FP
+    static constexpr bool is_exact =
+        std::numeric_limits<FP>::is_exact
+        || boost::safe_float::policy::checks_only_category<FP, CHECK<FP>,
+                                                           boost::safe_float::policy::failure_category::inexact>;
     static constexpr bool has_quiet_NaN = std::numeric_limits<FP>::has_quiet_NaN; // TODO: check policies for nan
     static constexpr bool has_signaling_NaN = std::numeric_limits<FP>::has_signaling_NaN; // TODO: check policies for
                                                                                           // nan
     static constexpr float_round_style round_style =
         std::numeric_limits<FP>::round_style; // TODO: check inexact policies
 
-    static constexpr number_type min() noexcept(std::numeric_limits<FP>::min())
+    static constexpr number_type min() noexcept
     {
         return boost::safe_float::safe_float<FP, CHECK, ERROR_HANDLING, CAST>(std::numeric_limits<FP>::min());
     }
-    static constexpr number_type max() noexcept(std::numeric_limits<FP>::max())
+    static constexpr number_type max() noexcept
     {
         return boost::safe_float::safe_float<FP, CHECK, ERROR_HANDLING, CAST>(std::numeric_limits<FP>::max());
     }
-    static constexpr number_type lowest() noexcept(max) { return -(max)(); }
-    static constexpr number_type epsilon() noexcept(std::numeric_limits<FP>::epsilon())
+    static constexpr number_type lowest() noexcept { return -(max)(); }
+    static constexpr number_type epsilon() noexcept
     {
         return boost::safe_float::safe_float<FP, CHECK, ERROR_HANDLING, CAST>(std::numeric_limits<FP>::epsilon());
     }
-    static constexpr number_type round_error() noexcept(std::numeric_limits<FP>::round_error())
+    static constexpr number_type round_error() noexcept
     {
-        // TODO: check for inexact policies
-        return boost::safe_float::safe_float<FP, CHECK, ERROR_HANDLING, CAST>(std::numeric_limits<FP>::round_error());
+        FP const error = is_exact ? FP(0) : std::numeric_limits<FP>::round_error();
+        return boost::safe_float::safe_float<FP, CHECK, ERROR_HANDLING, CAST>(error);
     }
-    static constexpr number_type infinity() noexcept(std::numeric_limits<FP>::infinity())
+    static constexpr number_type infinity() noexcept
     {
         return boost::safe_float::safe_float<FP, CHECK, ERROR_HANDLING, CAST>(std::numeric_limits<FP>::infinity());
     }
-    static constexpr number_type quiet_NaN() noexcept(std::numeric_limits<FP>::quiet_NaN())
+    static constexpr number_type quiet_NaN() noexcept
     {
         return boost::safe_float::safe_float<FP, CHECK, ERROR_HANDLING, CAST>(std::numeric_limits<FP>::quiet_NaN());
     }
-    static constexpr number_type signaling_NaN() noexcept(std::numeric_limits<FP>::signaling_NaN())
+    static constexpr number_type signaling_NaN() noexcept
     {
         return boost::safe_float::safe_float<FP, CHECK, ERROR_HANDLING, CAST>(std::numeric_limits<FP>::signaling_NaN());
     }
-    static number_type denorm_min() noexcept(std::numeric_limits<FP>::denorm_min())
+    static constexpr number_type denorm_min() noexcept
     {
         return boost::safe_float::safe_float<FP, CHECK, ERROR_HANDLING, CAST>(std::numeric_limits<FP>::denorm_min());
     }
@@ -0,0 +1,134 @@
+#ifndef BOOST_SAFE_FLOAT_BATCH_HPP
+#define BOOST_SAFE_FLOAT_BATCH_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+#if __has_include(<span>)
+#    include <span>
+#endif
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/policy/fused_checker.hpp>
+
+// This file defines checked arithmetic over whole arrays of FP.
+// The checks are done once per batch: FE_* flags are cleared before the loop and tested after it, software checks
+// are accumulated without branching. Only when the batch failed, a scalar rescan finds the first failing element.
+
+namespace boost
+{
+namespace safe_float
+{
+namespace batch
+{
+namespace detail
+{
+template<typename ERROR_HANDLING, typename = std::void_t<>>
+struct has_report_batch_failure : std::false_type
+{};
+
+template<typename ERROR_HANDLING>
+struct has_report_batch_failure<ERROR_HANDLING,
+                                std::void_t<decltype(std::declval<ERROR_HANDLING&>().report_batch_failure(
+                                    std::declval<const std::string&>(), std::declval<std::size_t>()))>> :
+    std::true_type
+{};
+
+template<typename ERROR_HANDLING>
+void report_batch_failure(ERROR_HANDLING& handler, const std::string& message, std::size_t index)
+{
+    if constexpr (has_report_batch_failure<ERROR_HANDLING>::value)
+        handler.report_batch_failure(message, index);
+    else
+        handler.report_failure(message + " (element " + std::to_string(index) + ")");
+}
+
+#define BOOST_SAFE_FLOAT_BATCH_OPERATION(name, operation, OP)                                            \
+    template<typename FP, typename POLICY, typename ERROR_HANDLING>                                      \
+    void name(const FP* lhs, const FP* rhs, FP* out, std::size_t size, ERROR_HANDLING& handler)          \
+    {                                                                                                    \
+        using checker = policy::fused_checker<FP, POLICY>;                                               \
+        constexpr int flags = checker::operation##_fenv_flags;                                           \
+                                                                                                         \
+        if constexpr (flags != 0) policy::fenv_flags::clear<FP>(flags);                                  \
+        bool ok = true;                                                                                  \
+        for (std::size_t i = 0; i < size; ++i)                                                           \
+        {                                                                                                \
+            FP const l = lhs[i];                                                                         \
+            FP const r = rhs[i];                                                                         \
+            out[i] = l OP r;                                                                             \
+            ok &= checker::operation##_check(l, r, out[i]);                                              \
+        }                                                                                                \
+        if constexpr (flags != 0) ok &= !policy::fenv_flags::test<FP>(flags);                            \
+        if (ok) return;                                                                                  \
+                                                                                                         \
+        /* rare path: replay the elements one by one with the scalar checks to find the first failure */ \
+        POLICY p{};                                                                                      \
+        for (std::size_t i = 0; i < size; ++i)                                                           \
+        {                                                                                                \
+            policy::detail::capture_failure capture;                                                     \
+            policy::detail::checked_##operation(p, lhs[i], rhs[i], capture);                             \
+            if (capture.failed)                                                                          \
+            {                                                                                            \
+                report_batch_failure(handler, capture.message, i);                                       \
+                return;                                                                                  \
+            }                                                                                            \
+        }                                                                                                \
+    }
+
+BOOST_SAFE_FLOAT_BATCH_OPERATION(add, addition, +)
+BOOST_SAFE_FLOAT_BATCH_OPERATION(sub, subtraction, -)
+BOOST_SAFE_FLOAT_BATCH_OPERATION(mul, multiplication, *)
+BOOST_SAFE_FLOAT_BATCH_OPERATION(div, division, /)
+
+#undef BOOST_SAFE_FLOAT_BATCH_OPERATION
+} // namespace detail
+} // namespace batch
+
+// Checked element-wise operations: out[i] = lhs[i] op rhs[i] for i in [0, size), out must not overlap the operands
+// The failing index is given to the handler through report_batch_failure(message, index) when it provides it,
+// otherwise it is appended to the message given to report_failure.
+#define BOOST_SAFE_FLOAT_CHECKED_BATCH(name, impl)                                                                    \
+    template<template<typename> typename CHECK = policy::check_all, typename ERROR_HANDLING = policy::on_fail_throw,   \
+             typename FP>                                                                                             \
+    void name(const FP* lhs, const FP* rhs, FP* out, std::size_t size, ERROR_HANDLING handler = ERROR_HANDLING{})     \
+    {                                                                                                                 \
+        static_assert(std::is_floating_point<FP>::value, "Batch operations work on floating point data types");     \
+        batch::detail::impl<FP, CHECK<FP>>(lhs, rhs, out, size, handler);                                             \
+    }
+
+BOOST_SAFE_FLOAT_CHECKED_BATCH(checked_add, add)
+BOOST_SAFE_FLOAT_CHECKED_BATCH(checked_sub, sub)
+BOOST_SAFE_FLOAT_CHECKED_BATCH(checked_mul, mul)
+BOOST_SAFE_FLOAT_CHECKED_BATCH(checked_div, div)
+
+#undef BOOST_SAFE_FLOAT_CHECKED_BATCH
+
+#ifdef __cpp_lib_span
+// std::span versions, the three spans are expected to have the same size
+#    define BOOST_SAFE_FLOAT_CHECKED_BATCH_SPAN(name)                                                                 \
+        template<template<typename> typename CHECK = policy::check_all,                                               \
+                 typename ERROR_HANDLING = policy::on_fail_throw, typename FP>                                        \
+        void name(std::span<const FP> lhs, std::span<const FP> rhs, std::span<FP> out,                                \
+                  ERROR_HANDLING handler = ERROR_HANDLING{})                                                          \
+        {                                                                                                             \
+            if (lhs.size() != rhs.size() || lhs.size() != out.size())                                                 \
+                handler.report_failure("Batch operands and output have different sizes");                            \
+            name<CHECK>(lhs.data(), rhs.data(), out.data(), std::min({lhs.size(), rhs.size(), out.size()}),           \
+                        handler);                                                                                     \
+        }
+
+BOOST_SAFE_FLOAT_CHECKED_BATCH_SPAN(checked_add)
+BOOST_SAFE_FLOAT_CHECKED_BATCH_SPAN(checked_sub)
+BOOST_SAFE_FLOAT_CHECKED_BATCH_SPAN(checked_mul)
+BOOST_SAFE_FLOAT_CHECKED_BATCH_SPAN(checked_div)
+
+#    undef BOOST_SAFE_FLOAT_CHECKED_BATCH_SPAN
+#endif
+
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_BATCH_HPP
@@ -0,0 +1,648 @@
+#ifndef BOOST_SAFE_FLOAT_BATCH_MATH_HPP
+#define BOOST_SAFE_FLOAT_BATCH_MATH_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#if __has_include(<span>)
+#    include <span>
+#endif
+#if defined(__SSE2__)
+#    include <immintrin.h>
+#endif
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/batch.hpp>
+#include <boost/safe_float/cmath.hpp>
+#include <boost/safe_float/simd.hpp>
+
+// This file defines exp, log, sqrt, pow, sin and cos over whole arrays of safe_float.
+// The float and double values are evaluated by vectors of the widest registers of the target, with polynomial
+// versions of the functions computed in double: the results are within 2 ulps of the ones of <cmath>, sqrt is
+// correctly rounded. The arguments certain to fail are found as vector masks before the evaluation, the results as
+// vector masks after it. Only from the first block of vectors having a lane that may fail, the values are replayed
+// with the scalar checks of cmath.hpp to find the first failure. long double values are evaluated by <cmath>, then
+// checked the same way.
+
+namespace boost
+{
+namespace safe_float
+{
+namespace batch
+{
+namespace detail
+{
+template<std::size_t N>
+using dvec = typename simd::detail::vector<double, N>::type;
+
+template<std::size_t N>
+using dmask = typename simd::detail::vector<double, N>::mask;
+
+// Adding it to a double below 2^51 rounds it to an integer held by the low bits of the mantissa
+constexpr double shifter = 0x1.8p52;
+
+// c[FIRST] + c[FIRST + 1] x + ... + c[FIRST + COUNT - 1] x^(COUNT - 1) by the scheme of Estrin: the halves are
+// evaluated independently, the dependency chains are shorter than the ones of the scheme of Horner
+template<std::size_t FIRST, std::size_t COUNT, std::size_t N, std::size_t K>
+dvec<N> estrin(const dvec<N> (&powers)[4], const double (&c)[K])
+{
+    if constexpr (COUNT == 1)
+        return dvec<N>{} + c[FIRST];
+    else if constexpr (COUNT == 2)
+        return c[FIRST] + c[FIRST + 1] * powers[0];
+    else
+    {
+        constexpr std::size_t half = COUNT > 8 ? 8 : COUNT > 4 ? 4 : 2;
+        constexpr std::size_t power = half == 8 ? 3 : half == 4 ? 2 : 1;
+        return estrin<FIRST, half, N>(powers, c) + powers[power] * estrin<FIRST + half, COUNT - half, N>(powers, c);
+    }
+}
+
+// c[0] + c[1] x + c[2] x^2 + ...
+template<std::size_t N, std::size_t K>
+dvec<N> polynomial(const dvec<N>& x, const double (&c)[K])
+{
+    static_assert(K <= 16, "The powers of x go up to x^8");
+    dvec<N> powers[4] = {x, x * x};
+    powers[2] = powers[1] * powers[1];
+    powers[3] = powers[2] * powers[2];
+    return estrin<0, K, N>(powers, c);
+}
+
+// 2^k for the integer lanes k in [-1022, 1023]
+template<std::size_t N>
+dvec<N> pow2(const dmask<N>& k)
+{
+    return (dvec<N>)((k + 1023) << 52);
+}
+
+template<std::size_t N>
+dmask<N> sign_bit()
+{
+    return (dmask<N>)(-dvec<N>{});
+}
+
+// hi + lo == a * b exactly: by the fma instructions when the target has them, otherwise by the split of Dekker, which
+// a contraction in fma would break
+template<std::size_t N>
+void two_product(const dvec<N>& a, const dvec<N>& b, dvec<N>& hi, dvec<N>& lo)
+{
+    hi = a * b;
+#if defined(__FMA__)
+#    if defined(__AVX512F__)
+    if constexpr (sizeof(dvec<N>) == 64)
+    {
+        lo = (dvec<N>)_mm512_fmsub_pd((__m512d)a, (__m512d)b, (__m512d)hi);
+        return;
+    }
+#    endif
+    if constexpr (sizeof(dvec<N>) == 32)
+        lo = (dvec<N>)_mm256_fmsub_pd((__m256d)a, (__m256d)b, (__m256d)hi);
+    else if constexpr (sizeof(dvec<N>) == 16)
+        lo = (dvec<N>)_mm_fmsub_pd((__m128d)a, (__m128d)b, (__m128d)hi);
+    else
+        for (std::size_t i = 0; i < N; ++i) lo[i] = std::fma(a[i], b[i], -hi[i]);
+#else
+    constexpr double splitter = 0x1p27 + 1;
+    dvec<N> const ca = splitter * a, cb = splitter * b;
+    dvec<N> const a_hi = ca - (ca - a), b_hi = cb - (cb - b);
+    dvec<N> const a_lo = a - a_hi, b_lo = b - b_hi;
+    lo = ((a_hi * b_hi - hi) + a_hi * b_lo + a_lo * b_hi) + a_lo * b_lo;
+#endif
+}
+
+// hi + lo == (a_hi + a_lo) + (b_hi + b_lo) in double-double, a_hi and b_hi don't cancel each other
+template<std::size_t N>
+void add(const dvec<N>& a_hi, const dvec<N>& a_lo, const dvec<N>& b_hi, const dvec<N>& b_lo, dvec<N>& hi,
+         dvec<N>& lo)
+{
+    dvec<N> const s = a_hi + b_hi;
+    dvec<N> const b_part = s - a_hi;
+    dvec<N> const error = ((a_hi - (s - b_part)) + (b_hi - b_part)) + (a_lo + b_lo);
+    hi = s + error;
+    lo = error - (hi - s);
+}
+
+// integer lanes, the ones of magnitude above 2^52 are
+template<std::size_t N>
+dmask<N> is_integer(const dvec<N>& v)
+{
+    dvec<N> const m = simd::detail::magnitude<double, N>(v);
+    return (m >= 0x1p52) | ((m + 0x1p52) - 0x1p52 == m);
+}
+
+// ln(2) = ln2_hi + ln2_lo, ln2_hi has 21 trailing zero bits: k * ln2_hi is exact for the exponents k
+constexpr double ln2_hi = 6.93147180369123816490e-01;
+constexpr double ln2_lo = 1.90821492927058770002e-10;
+
+// 1/2! + x/3! + x^2/4! + ... for exp on [-ln(2)/2, ln(2)/2]
+constexpr double exp_coefficients[] = {1.0 / 2,         1.0 / 6,           1.0 / 24,          1.0 / 120,
+                                       1.0 / 720,       1.0 / 5040,        1.0 / 40320,       1.0 / 362880,
+                                       1.0 / 3628800,   1.0 / 39916800,    1.0 / 479001600,   1.0 / 6227020800};
+
+// 2/5 + 2/7 z + 2/9 z^2 + ... for log(1 + f) = 2 atanh(s) = 2s + 2/3 s^3 + s^5 (2/5 + 2/7 s^2 + ...), |s| < 0.172
+constexpr double log_coefficients[] = {2.0 / 5,  2.0 / 7,  2.0 / 9,  2.0 / 11, 2.0 / 13,
+                                       2.0 / 15, 2.0 / 17, 2.0 / 19, 2.0 / 21, 2.0 / 23};
+
+// -1/3! + z/5! - z^2/7! + ... and 1/4! - z/6! + z^2/8! - ... for sin and cos on [-pi/4, pi/4]
+constexpr double sin_coefficients[] = {-1.0 / 6,           1.0 / 120,           -1.0 / 5040,
+                                       1.0 / 362880,       -1.0 / 39916800,     1.0 / 6227020800,
+                                       -1.0 / 1307674368000, 1.0 / 355687428096000};
+constexpr double cos_coefficients[] = {1.0 / 24,           -1.0 / 720,         1.0 / 40320,
+                                       -1.0 / 3628800,     1.0 / 479001600,    -1.0 / 87178291200,
+                                       1.0 / 20922789888000, -1.0 / 6402373705728000, 1.0 / 2432902008176640000.0};
+
+// exp(hi + lo), lo being below the ulp of hi
+template<std::size_t N>
+dvec<N> exp_lanes(const dvec<N>& hi, const dvec<N>& lo)
+{
+    constexpr double log2e = 1.44269504088896338700e+00;
+    // beyond, the results overflow or underflow to 0
+    dvec<N> const x = hi > 710.0 ? dvec<N>{} + 710.0 : hi < -746.0 ? dvec<N>{} - 746.0 : hi;
+    // x = k ln(2) + r, |r| <= ln(2)/2
+    dvec<N> const shifted = x * log2e + shifter;
+    dvec<N> const k = shifted - shifter;
+    dmask<N> const exponent = (dmask<N>)shifted - (dmask<N>)(dvec<N>{} + shifter);
+    dvec<N> const r = ((x - k * ln2_hi) - k * ln2_lo) + lo;
+    dvec<N> const p = 1.0 + (r + r * r * polynomial<N>(r, exp_coefficients));
+    // 2^k as two factors, the results below min get a single rounding
+    dmask<N> const half = exponent >> 1;
+    return (p * pow2<N>(exponent - half)) * pow2<N>(half);
+}
+
+// x = 2^e m with m in [sqrt(1/2), sqrt(2)), for the positive finite lanes
+template<std::size_t N>
+void decompose(const dvec<N>& x, dvec<N>& m, dvec<N>& e)
+{
+    dmask<N> const subnormal = x < std::numeric_limits<double>::min();
+    dmask<N> const bits = (dmask<N>)(subnormal ? x * 0x1p54 : x);
+    m = (dvec<N>)((bits & 0x000fffffffffffff) | 0x3ff0000000000000);
+    dmask<N> const high = m > 1.41421356237309504880;
+    m = high ? m * 0.5 : m;
+    dmask<N> const exponent = ((bits >> 52) & 0x7ff) - 1023 + (subnormal & -54) - high;
+    e = (dvec<N>)(exponent + (dmask<N>)(dvec<N>{} + shifter)) - shifter;
+}
+
+template<std::size_t N>
+dvec<N> log_lanes(const dvec<N>& x)
+{
+    dvec<N> m, e;
+    decompose<N>(x, m, e);
+    // log(1 + f) = f - f^2/2 + s (f^2/2 + R)
+    dvec<N> const f = m - 1.0;
+    dvec<N> const s = f / (2.0 + f);
+    dvec<N> const z = s * s;
+    dvec<N> const R = z * (2.0 / 3 + z * polynomial<N>(z, log_coefficients));
+    dvec<N> const hfsq = 0.5 * f * f;
+    dvec<N> const r = e * ln2_hi - ((hfsq - (s * (hfsq + R) + e * ln2_lo)) - f);
+    dvec<N> const inf = dvec<N>{} + std::numeric_limits<double>::infinity();
+    dvec<N> const special = x == 0 ? -inf : x < 0 ? dvec<N>{} + std::numeric_limits<double>::quiet_NaN() : x;
+    return (x > 0) & (x < inf) ? r : special;
+}
+
+// log(x) = hi + lo with about 64 bits, for the positive finite lanes: y log(x) is kept exact enough for pow
+template<std::size_t N>
+void log_lanes(const dvec<N>& x, dvec<N>& hi, dvec<N>& lo)
+{
+    constexpr double two_thirds_hi = 2.0 / 3;
+    constexpr double two_thirds_lo = 3.7007434154171886e-17;
+    dvec<N> m, e;
+    decompose<N>(x, m, e);
+    // s = f / (2 + f) in double-double
+    dvec<N> const f = m - 1.0;
+    dvec<N> const u_hi = 2.0 + f;
+    dvec<N> const u_lo = (2.0 - u_hi) + f;
+    dvec<N> const s_hi = f / u_hi;
+    dvec<N> p, p_lo;
+    two_product<N>(s_hi, u_hi, p, p_lo);
+    dvec<N> const s_lo = (((f - p) - p_lo) - s_hi * u_lo) / u_hi;
+    // 2/3 s^3 in double-double, the higher powers in double
+    dvec<N> z, z_lo, c, c_lo, t, t_lo;
+    two_product<N>(s_hi, s_hi, z, z_lo);
+    two_product<N>(z, s_hi, c, c_lo);
+    c_lo += z_lo * s_hi + 3.0 * z * s_lo;
+    two_product<N>(c, dvec<N>{} + two_thirds_hi, t, t_lo);
+    t_lo += (c * two_thirds_lo + c_lo * two_thirds_hi) + c * z * polynomial<N>(z, log_coefficients);
+    dvec<N> l, l_lo;
+    add<N>(2.0 * s_hi, 2.0 * s_lo, t, t_lo, l, l_lo);
+    add<N>(e * ln2_hi, e * ln2_lo, l, l_lo, hi, lo);
+}
+
+template<std::size_t N>
+dvec<N> pow_lanes(const dvec<N>& x, const dvec<N>& y)
+{
+    dvec<N> const ax = simd::detail::magnitude<double, N>(x);
+    dvec<N> const ay = simd::detail::magnitude<double, N>(y);
+    dmask<N> const integer = (ay < 0x1p52) & ((ay + 0x1p52) - 0x1p52 == ay);
+    dmask<N> const odd = integer & (((dmask<N>)(ay + 0x1p52) & 1) != 0);
+    // finite lanes with a positive base, or a negative one and an integer exponent, the others are special cases
+    dmask<N> const general = simd::detail::is_finite<double, N>(x) & simd::detail::is_finite<double, N>(y)
+                             & ((x > 0) | ((x < 0) & integer));
+    dvec<N> const base = general ? ax : dvec<N>{} + 1.0;
+    dvec<N> l, l_lo, p, p_lo;
+    log_lanes<N>(base, l, l_lo);
+    two_product<N>(y, l, p, p_lo);
+    // the split of huge exponents overflows, exp(p) is infinite, 0 or 1 for them
+    p_lo = (simd::detail::magnitude<double, N>(p) < 1000.0) & (ay < 0x1p996) ? p_lo + y * l_lo : dvec<N>{};
+    dvec<N> r = exp_lanes<N>(p, p_lo);
+    r = (dvec<N>)((dmask<N>)r ^ (odd & (x < 0) & sign_bit<N>()));
+    if (simd::detail::any_lane<double, N>(~general))
+        for (std::size_t i = 0; i < N; ++i)
+            if (!general[i]) r[i] = std::pow(x[i], y[i]);
+    return r;
+}
+
+// Beyond, the reduction by pi/2 isn't exact and the lanes are evaluated by <cmath>
+constexpr double sincos_bound = 0x1p20;
+
+template<bool COSINE, std::size_t N>
+dvec<N> sincos_lanes(const dvec<N>& x)
+{
+    constexpr double two_over_pi = 6.36619772367581382433e-01;
+    // pi/2 = pio2_1 + pio2_2 + pio2_2t, pio2_1 and pio2_2 have 33 bits: k * pio2_1 and k * pio2_2 are exact
+    constexpr double pio2_1 = 1.57079632673412561417e+00;
+    constexpr double pio2_2 = 6.07710050630396597660e-11;
+    constexpr double pio2_2t = 2.02226624879595063154e-21;
+    dmask<N> const reduced = simd::detail::magnitude<double, N>(x) <= sincos_bound;
+    dvec<N> const v = reduced ? x : dvec<N>{};
+    // v = k pi/2 + r, |r| <= pi/4
+    dvec<N> const shifted = v * two_over_pi + shifter;
+    dvec<N> const k = shifted - shifter;
+    dmask<N> const quadrant = (dmask<N>)shifted - (dmask<N>)(dvec<N>{} + shifter);
+    dvec<N> const t = v - k * pio2_1;
+    dvec<N> w = k * pio2_2;
+    dvec<N> r = t - w;
+    w = k * pio2_2t - ((t - r) - w);
+    r = r - w;
+    dvec<N> const z = r * r;
+    dvec<N> const sin_r = r + r * z * polynomial<N>(z, sin_coefficients);
+    dvec<N> const cos_r = 1.0 - 0.5 * z + z * z * polynomial<N>(z, cos_coefficients);
+    // sin and cos of r, with their signs, by quadrant
+    dmask<N> const odd = (quadrant & 1) != 0;
+    dvec<N> const value = COSINE ? (odd ? sin_r : cos_r) : (odd ? cos_r : sin_r);
+    dmask<N> const negative = ((COSINE ? quadrant + 1 : quadrant) & 2) != 0;
+    dvec<N> result = (dvec<N>)((dmask<N>)value ^ (negative & sign_bit<N>()));
+    // NaN for the infinite lanes
+    result = reduced ? result : x - x;
+    dmask<N> const large = ~reduced & simd::detail::is_finite<double, N>(x);
+    if (simd::detail::any_lane<double, N>(large))
+        for (std::size_t i = 0; i < N; ++i)
+            if (large[i]) result[i] = COSINE ? std::cos(x[i]) : std::sin(x[i]);
+    return result;
+}
+
+template<std::size_t N>
+dvec<N> sqrt_lanes(const dvec<N>& v)
+{
+#if defined(__AVX512F__)
+    if constexpr (sizeof(dvec<N>) == 64) return (dvec<N>)_mm512_sqrt_pd((__m512d)v);
+#endif
+#if defined(__AVX__)
+    if constexpr (sizeof(dvec<N>) == 32) return (dvec<N>)_mm256_sqrt_pd((__m256d)v);
+#endif
+#if defined(__SSE2__)
+    if constexpr (sizeof(dvec<N>) == 16) return (dvec<N>)_mm_sqrt_pd((__m128d)v);
+#endif
+    dvec<N> r;
+    for (std::size_t i = 0; i < N; ++i) r[i] = std::sqrt(v[i]);
+    return r;
+}
+
+// The functions: their name and pole for the messages, their outcomes certain from the arguments, as scalars for the
+// replay and as masks of the lanes possibly failing, and their evaluation by lanes and by <cmath>
+struct exp_function
+{
+    static constexpr const char* name = "exp";
+    static constexpr bool pole = false;
+    static constexpr bool checks_inexact = false;
+
+    template<class FP>
+    static math::detail::outcome certain(FP v)
+    {
+        return math::detail::exp_certain(v);
+    }
+
+    template<class FP, std::size_t N>
+    static dmask<N> certain_lanes(const dvec<N>& v)
+    {
+        return (v > double(math::detail::exp_overflow_bound<FP>)) | (v < double(math::detail::exp_underflow_bound<FP>));
+    }
+
+    template<std::size_t N>
+    static dvec<N> evaluate(const dvec<N>& v)
+    {
+        return exp_lanes<N>(v, dvec<N>{});
+    }
+
+    template<class FP>
+    static FP scalar(FP v)
+    {
+        return std::exp(v);
+    }
+};
+
+struct log_function
+{
+    static constexpr const char* name = "log";
+    static constexpr bool pole = true;
+    static constexpr bool checks_inexact = false;
+
+    template<class FP>
+    static math::detail::outcome certain(FP v)
+    {
+        return math::detail::log_certain(v);
+    }
+
+    template<class FP, std::size_t N>
+    static dmask<N> certain_lanes(const dvec<N>& v)
+    {
+        return v <= 0;
+    }
+
+    template<std::size_t N>
+    static dvec<N> evaluate(const dvec<N>& v)
+    {
+        return log_lanes<N>(v);
+    }
+
+    template<class FP>
+    static FP scalar(FP v)
+    {
+        return std::log(v);
+    }
+};
+
+struct sqrt_function
+{
+    static constexpr const char* name = "sqrt";
+    static constexpr bool pole = false;
+    static constexpr bool checks_inexact = true;
+
+    template<class FP>
+    static math::detail::outcome certain(FP v)
+    {
+        return math::detail::sqrt_certain(v);
+    }
+
+    template<class FP, std::size_t N>
+    static dmask<N> certain_lanes(const dvec<N>& v)
+    {
+        return v < 0;
+    }
+
+    template<std::size_t N>
+    static dvec<N> evaluate(const dvec<N>& v)
+    {
+        return sqrt_lanes<N>(v);
+    }
+
+    template<class FP>
+    static FP scalar(FP v)
+    {
+        return std::sqrt(v);
+    }
+
+    template<class FP>
+    static bool exact(FP root, FP v)
+    {
+        return math::detail::exact_root(v, root);
+    }
+
+    // root the result rounded to FP: the lanes where root^2 != v, and the tiny ones where the product underflows
+    template<std::size_t N>
+    static dmask<N> inexact_lanes(const dvec<N>& root, const dvec<N>& v)
+    {
+        dvec<N> square, error;
+        two_product<N>(root, root, square, error);
+        return ((square != v) | (error != 0) | (v < 0x1p-968)) & simd::detail::is_finite<double, N>(root);
+    }
+};
+
+struct pow_function
+{
+    static constexpr const char* name = "pow";
+    static constexpr bool pole = false;
+    static constexpr bool checks_inexact = false;
+
+    template<class FP>
+    static math::detail::outcome certain(FP v, FP w)
+    {
+        return math::detail::pow_certain(v, w);
+    }
+
+    template<class FP, std::size_t N>
+    static dmask<N> certain_lanes(const dvec<N>& v, const dvec<N>& w)
+    {
+        return ((v == 0) & (w < 0)) | ((v < 0) & ~is_integer<N>(w));
+    }
+
+    template<std::size_t N>
+    static dvec<N> evaluate(const dvec<N>& v, const dvec<N>& w)
+    {
+        return pow_lanes<N>(v, w);
+    }
+
+    template<class FP>
+    static FP scalar(FP v, FP w)
+    {
+        return std::pow(v, w);
+    }
+};
+
+#define BOOST_SAFE_FLOAT_BATCH_SINCOS_FUNCTION(function, COSINE) \
+    struct function##_function                                   \
+    {                                                            \
+        static constexpr const char* name = #function;           \
+        static constexpr bool pole = false;                      \
+        static constexpr bool checks_inexact = false;            \
+                                                                 \
+        template<class FP>                                       \
+        static math::detail::outcome certain(FP)                 \
+        {                                                        \
+            return math::detail::outcome::valid;                 \
+        }                                                        \
+                                                                 \
+        template<class FP, std::size_t N>                        \
+        static dmask<N> certain_lanes(const dvec<N>&)            \
+        {                                                        \
+            return dmask<N>{};                                   \
+        }                                                        \
+                                                                 \
+        template<std::size_t N>                                  \
+        static dvec<N> evaluate(const dvec<N>& v)                \
+        {                                                        \
+            return sincos_lanes<COSINE, N>(v);                   \
+        }                                                        \
+                                                                 \
+        template<class FP>                                       \
+        static FP scalar(FP v)                                   \
+        {                                                        \
+            return std::function(v);                             \
+        }                                                        \
+    };
+
+BOOST_SAFE_FLOAT_BATCH_SINCOS_FUNCTION(sin, false)
+BOOST_SAFE_FLOAT_BATCH_SINCOS_FUNCTION(cos, true)
+
+#undef BOOST_SAFE_FLOAT_BATCH_SINCOS_FUNCTION
+
+// Lanes of the results rounded to FP that are not finite or are subnormal as FP
+template<class FP, std::size_t N>
+dmask<N> unusual_lanes(const dvec<N>& result)
+{
+    dvec<N> const m = simd::detail::magnitude<double, N>(result);
+    return ~(m <= double(std::numeric_limits<FP>::max()))
+           | ((m < double(std::numeric_limits<FP>::min())) & (m != 0));
+}
+
+// Evaluates FUNCTION on the n <= N first values of the arguments, returns the lanes that may fail the checks
+template<class FUNCTION, class FP, std::size_t N, bool CHECKED, bool INEXACT, class... ARG>
+dmask<N> evaluate_lanes(FP* out, std::size_t n, const ARG*... args)
+{
+    using fvec = typename simd::detail::vector<FP, N>::type;
+    // the missing lanes of the last values are set to 1, in the domain of every function
+    auto const load = [n](const FP* p) {
+        fvec v = fvec{} + FP(1);
+        if (n == N)
+            std::memcpy(&v, p, sizeof(fvec));
+        else
+            std::memcpy(&v, p, n * sizeof(FP));
+        return __builtin_convertvector(v, dvec<N>);
+    };
+    return [out, n](const auto&... v) {
+        fvec const result = __builtin_convertvector(FUNCTION::template evaluate<N>(v...), fvec);
+        if (n == N)
+            std::memcpy(out, &result, sizeof(fvec));
+        else
+            std::memcpy(out, &result, n * sizeof(FP));
+        if constexpr (!CHECKED)
+            return dmask<N>{};
+        else
+        {
+            dvec<N> const rounded = __builtin_convertvector(result, dvec<N>);
+            dmask<N> failing = FUNCTION::template certain_lanes<FP, N>(v...) | unusual_lanes<FP, N>(rounded);
+            if constexpr (INEXACT) failing |= FUNCTION::template inexact_lanes<N>(rounded, v...);
+            return failing;
+        }
+    }(load(args)...);
+}
+
+// out[i] = FUNCTION(args[i]...) for i in [0, size), the first failure is reported with its index
+template<class FUNCTION, class ERROR_HANDLING, class SF, class... ARG>
+void apply(ERROR_HANDLING& handler, SF* out, std::size_t size, const ARG*... args)
+{
+    using FP = typename SF::value_type;
+    using POLICY = typename SF::check_policy;
+    using checks = math::detail::function_checks<FP, POLICY>;
+    using math::detail::outcome;
+    static_assert(is_safe_float<SF>::value && (std::is_same<SF, ARG>::value && ...),
+                  "Batch functions work on arrays of the same safe_float");
+    require_fp_layout<SF>();
+    constexpr bool inexact = FUNCTION::checks_inexact && checks::reports(outcome::inexact);
+    constexpr bool checked = checks::any || inexact;
+
+    FP* const results = reinterpret_cast<FP*>(out);
+    // first value of the first block having a lane that may fail
+    std::size_t suspect = size;
+    if constexpr (std::is_same<FP, float>::value || std::is_same<FP, double>::value)
+    {
+        // blocks of four vectors, the lanes that may fail are tested once per block
+        constexpr std::size_t lanes = policy::fenv_flags::detail::vector_register_size / sizeof(double);
+        constexpr std::size_t block = 4 * lanes;
+        for (std::size_t i = 0; i < size; i += block)
+        {
+            dmask<lanes> failing{};
+            for (std::size_t j = i; j < i + block && j < size; j += lanes)
+                failing |= evaluate_lanes<FUNCTION, FP, lanes, checked, inexact>(
+                    results + j, std::min(lanes, size - j), (reinterpret_cast<const FP*>(args) + j)...);
+            if (suspect == size && simd::detail::any_lane<double, lanes>(failing)) suspect = i;
+        }
+    }
+    else
+    {
+        for (std::size_t i = 0; i < size; ++i) results[i] = FUNCTION::scalar(reinterpret_cast<const FP*>(args)[i]...);
+        suspect = 0;
+    }
+    if constexpr (!checked) return;
+
+    // rare path: replay the values with the scalar checks to find the first failure
+    for (std::size_t i = suspect; i < size; ++i)
+    {
+        outcome o = math::detail::reported_outcome<FP, POLICY>(
+            FUNCTION::pole, FUNCTION::certain(reinterpret_cast<const FP*>(args)[i]...), results[i],
+            reinterpret_cast<const FP*>(args)[i]...);
+        if constexpr (inexact)
+            if (o == outcome::valid && !FUNCTION::exact(results[i], reinterpret_cast<const FP*>(args)[i]...))
+                o = outcome::inexact;
+        if (o != outcome::valid)
+        {
+            report_batch_failure(handler, math::detail::message(o, FUNCTION::name), i);
+            return;
+        }
+    }
+}
+} // namespace detail
+
+// Checked functions over arrays of safe_float: out[i] = function(x[i]) for i in [0, size), out must not overlap the
+// arguments. The outcomes checked are the ones of the functions of cmath.hpp, the first failure is given to the
+// handler with its index through report_batch_failure(message, index) when it provides it, otherwise appended to the
+// message given to report_failure.
+#define BOOST_SAFE_FLOAT_BATCH_UNARY_FUNCTION(function)                                              \
+    template<class SF, class ERROR_HANDLING = typename SF::report_policy>                            \
+    void function(const SF* x, SF* out, std::size_t size, ERROR_HANDLING handler = ERROR_HANDLING{}) \
+    {                                                                                                \
+        detail::apply<detail::function##_function>(handler, out, size, x);                           \
+    }
+
+BOOST_SAFE_FLOAT_BATCH_UNARY_FUNCTION(exp)
+BOOST_SAFE_FLOAT_BATCH_UNARY_FUNCTION(log)
+BOOST_SAFE_FLOAT_BATCH_UNARY_FUNCTION(sqrt)
+BOOST_SAFE_FLOAT_BATCH_UNARY_FUNCTION(sin)
+BOOST_SAFE_FLOAT_BATCH_UNARY_FUNCTION(cos)
+
+#undef BOOST_SAFE_FLOAT_BATCH_UNARY_FUNCTION
+
+// out[i] = pow(x[i], y[i])
+template<class SF, class ERROR_HANDLING = typename SF::report_policy>
+void pow(const SF* x, const SF* y, SF* out, std::size_t size, ERROR_HANDLING handler = ERROR_HANDLING{})
+{
+    detail::apply<detail::pow_function>(handler, out, size, x, y);
+}
+
+#ifdef __cpp_lib_span
+// std::span versions, the spans are expected to have the same size
+#    define BOOST_SAFE_FLOAT_BATCH_UNARY_FUNCTION_SPAN(function)                                           \
+        template<class SF, class ERROR_HANDLING = typename SF::report_policy>                            \
+        void function(std::span<const SF> x, std::span<SF> out, ERROR_HANDLING handler = ERROR_HANDLING{}) \
+        {                                                                                                 \
+            if (x.size() != out.size())                                                                   \
+                handler.report_failure("Batch operands and output have different sizes");                 \
+            function(x.data(), out.data(), std::min(x.size(), out.size()), handler);                      \
+        }
+
+BOOST_SAFE_FLOAT_BATCH_UNARY_FUNCTION_SPAN(exp)
+BOOST_SAFE_FLOAT_BATCH_UNARY_FUNCTION_SPAN(log)
+BOOST_SAFE_FLOAT_BATCH_UNARY_FUNCTION_SPAN(sqrt)
+BOOST_SAFE_FLOAT_BATCH_UNARY_FUNCTION_SPAN(sin)
+BOOST_SAFE_FLOAT_BATCH_UNARY_FUNCTION_SPAN(cos)
+
+#    undef BOOST_SAFE_FLOAT_BATCH_UNARY_FUNCTION_SPAN
+
+template<class SF, class ERROR_HANDLING = typename SF::report_policy>
+void pow(std::span<const SF> x, std::span<const SF> y, std::span<SF> out, ERROR_HANDLING handler = ERROR_HANDLING{})
+{
+    if (x.size() != y.size() || x.size() != out.size())
+        handler.report_failure("Batch operands and output have different sizes");
+    pow(x.data(), y.data(), out.data(), std::min({x.size(), y.size(), out.size()}), handler);
+}
+#endif
+
+} // namespace batch
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_BATCH_MATH_HPP
@@ -0,0 +1,76 @@
+#ifndef BOOST_SAFE_FLOAT_CHARCONV_HPP
+#define BOOST_SAFE_FLOAT_CHARCONV_HPP
+
+#include <charconv>
+#include <system_error>
+#if __has_include(<format>)
+#    include <format>
+#endif
+
+#include <boost/safe_float.hpp>
+
+// This file defines the conversions of safe_float from and to text without streams nor locales, with <charconv>.
+// The parse errors and the numbers out of the range of FP are reported to the handler of the safe_float parsed.
+
+namespace boost
+{
+namespace safe_float
+{
+template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
+std::to_chars_result to_chars(char* first, char* last, const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& value)
+{
+    return std::to_chars(first, last, value.get_stored_value());
+}
+
+template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
+std::to_chars_result to_chars(char* first, char* last, const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& value,
+                              std::chars_format fmt)
+{
+    return std::to_chars(first, last, value.get_stored_value(), fmt);
+}
+
+template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
+std::to_chars_result to_chars(char* first, char* last, const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& value,
+                              std::chars_format fmt, int precision)
+{
+    return std::to_chars(first, last, value.get_stored_value(), fmt, precision);
+}
+
+// value is only changed when the number is parsed, the error is reported before returning otherwise
+template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
+std::from_chars_result from_chars(const char* first, const char* last,
+                                  safe_float<FP, CHECK, ERROR_HANDLING, CAST>& value,
+                                  std::chars_format fmt = std::chars_format::general)
+{
+    FP number{};
+    auto const result = std::from_chars(first, last, number, fmt);
+    if (result.ec == std::errc::invalid_argument)
+        value.report_failure("Not a valid floating point number");
+    else if (result.ec == std::errc::result_out_of_range)
+        value.report_failure("Floating point number out of range");
+    else
+        value.set_stored_value(number);
+    return result;
+}
+
+} // namespace safe_float
+} // namespace boost
+
+
+#ifdef __cpp_lib_format
+namespace std
+{
+// safe_float is formatted as its FP, with the same format specifications
+template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST, class CharT>
+struct formatter<boost::safe_float::safe_float<FP, CHECK, ERROR_HANDLING, CAST>, CharT> : formatter<FP, CharT>
+{
+    template<class FormatContext>
+    auto format(const boost::safe_float::safe_float<FP, CHECK, ERROR_HANDLING, CAST>& value, FormatContext& ctx) const
+    {
+        return formatter<FP, CharT>::format(value.get_stored_value(), ctx);
+    }
+};
+} // namespace std
+#endif
+
+#endif // BOOST_SAFE_FLOAT_CHARCONV_HPP
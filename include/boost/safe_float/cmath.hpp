@@ -0,0 +1,321 @@
+#ifndef BOOST_SAFE_FLOAT_CMATH_HPP
+#define BOOST_SAFE_FLOAT_CMATH_HPP
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/convenience.hpp>
+#include <boost/safe_float/policy/classify.hpp>
+
+// This file defines the <cmath> functions of safe_float, checked by the check policy of their argument.
+// A policy checks on the functions the categories it detects on any arithmetic operation, and the check_*_finite
+// policies their non finite results: the NaN results as domain errors, the infinite results of finite arguments as pole
+// errors or overflows, the subnormal results as underflows. As the FE_* flags, a NaN or an infinite argument giving
+// a NaN or an infinite result isn't reported but by the check_*_finite policies. The results of the math library are
+// not correctly rounded in general, the only result checked for inexactness is the one of sqrt.
+// The arguments certain to fail, like exp(x) with x above log(max), are reported before the function is called, which
+// isn't called then: the function gives the result known for them, NaN or an infinity. The arguments certain to
+// underflow are reported after the call, their result may still be a subnormal value.
+
+namespace boost
+{
+namespace safe_float
+{
+namespace math
+{
+namespace detail
+{
+// What a function gives for its arguments
+enum class outcome : unsigned char
+{
+    valid,
+    domain_error,
+    pole_error,
+    overflow,
+    underflow,
+    inexact,
+    non_finite_operand
+};
+
+template<class FP, class POLICY>
+struct checks_finite : std::false_type
+{};
+
+template<class FP>
+struct checks_finite<FP, policy::check_addition_finite<FP>> : std::true_type
+{};
+
+template<class FP>
+struct checks_finite<FP, policy::check_subtraction_finite<FP>> : std::true_type
+{};
+
+template<class FP>
+struct checks_finite<FP, policy::check_multiplication_finite<FP>> : std::true_type
+{};
+
+template<class FP>
+struct checks_finite<FP, policy::check_division_finite<FP>> : std::true_type
+{};
+
+template<class FP, template<typename> typename... As>
+struct checks_finite<FP, policy::composed_check<FP, As...>> :
+    std::bool_constant<(checks_finite<FP, As<FP>>::value || ...)>
+{};
+
+// The outcomes POLICY reports on the functions
+template<class FP, class POLICY>
+struct function_checks
+{
+    template<policy::failure_category CATEGORY>
+    static constexpr bool detects()
+    {
+        using detected = policy::detected_category<FP, POLICY, CATEGORY>;
+        return detected::addition || detected::subtraction || detected::multiplication || detected::division;
+    }
+
+    static constexpr bool finite = checks_finite<FP, POLICY>::value;
+
+    static constexpr bool reports(outcome o)
+    {
+        switch (o)
+        {
+            case outcome::domain_error: return finite || detects<policy::failure_category::invalid_result>();
+            case outcome::pole_error: return finite || detects<policy::failure_category::division_by_zero>();
+            case outcome::overflow: return finite || detects<policy::failure_category::overflow>();
+            case outcome::underflow: return detects<policy::failure_category::underflow>();
+            case outcome::inexact: return detects<policy::failure_category::inexact>();
+            case outcome::non_finite_operand: return finite;
+            default: return false;
+        }
+    }
+
+    static constexpr bool any = reports(outcome::domain_error) || reports(outcome::pole_error)
+                                || reports(outcome::overflow) || reports(outcome::underflow);
+};
+
+inline std::string message(outcome o, const char* name)
+{
+    switch (o)
+    {
+        case outcome::domain_error: return std::string("Domain error on ") + name + " function";
+        case outcome::pole_error: return std::string("Pole error on ") + name + " function";
+        case outcome::overflow: return std::string("Overflow to infinite on ") + name + " function";
+        case outcome::underflow: return std::string("Underflow from ") + name + " function";
+        case outcome::inexact: return std::string("Non reversible ") + name + " applied";
+        case outcome::non_finite_operand: return std::string("Non finite operand given to ") + name + " function";
+        default: return std::string("Valid ") + name + " function";
+    }
+}
+
+// Outcome of a function from its result, pole when an infinite result of finite arguments is a pole error
+template<class FP, class... ARGS>
+outcome result_outcome(bool pole, FP result, ARGS... args)
+{
+    namespace classify = policy::classify;
+    if (classify::is_nan(result))
+        return (classify::is_nan(args) || ...) ? outcome::non_finite_operand : outcome::domain_error;
+    if (classify::is_inf(result))
+        return (classify::is_finite(args) && ...) ? (pole ? outcome::pole_error : outcome::overflow)
+                                                  : outcome::non_finite_operand;
+    if (classify::is_subnormal(result)) return outcome::underflow;
+    return outcome::valid;
+}
+
+// Bounds of x beyond which exp(x) certainly overflows or underflows: ln(max) < max_exponent * ln(2) and
+// exp((min_exponent - 1) * ln(2) - 1) < min
+template<class FP>
+constexpr FP exp_overflow_bound = FP(std::numeric_limits<FP>::max_exponent) * FP(0.693147180559945309417) + 1;
+
+template<class FP>
+constexpr FP exp_underflow_bound = FP(std::numeric_limits<FP>::min_exponent - 1) * FP(0.693147180559945309417) - 1;
+
+// Outcomes certain from the arguments, shared with the batch functions of batch_math.hpp
+template<class FP>
+outcome exp_certain(FP v)
+{
+    return v > exp_overflow_bound<FP> ? outcome::overflow : v < exp_underflow_bound<FP> ? outcome::underflow
+                                                                                        : outcome::valid;
+}
+
+template<class FP>
+outcome log_certain(FP v)
+{
+    return v < 0 ? outcome::domain_error : v == 0 ? outcome::pole_error : outcome::valid;
+}
+
+template<class FP>
+outcome pow_certain(FP v, FP w)
+{
+    return v == 0 && w < 0 ? outcome::pole_error : v < 0 && std::trunc(w) != w ? outcome::domain_error : outcome::valid;
+}
+
+template<class FP>
+outcome sqrt_certain(FP v)
+{
+    return v < 0 ? outcome::domain_error : outcome::valid;
+}
+
+// The square of an exact root is exactly the argument
+template<class FP>
+bool exact_root(FP v, FP root)
+{
+    return !policy::classify::is_finite(root) || std::fma(root, root, -v) == 0;
+}
+
+// Outcome of a function POLICY reports, certain is the outcome known from the arguments before the call when they are
+// finite
+template<class FP, class POLICY, class... ARGS>
+outcome reported_outcome(bool pole, outcome certain, FP result, ARGS... args)
+{
+    using checks = function_checks<FP, POLICY>;
+    if (certain != outcome::valid && checks::reports(certain) && (policy::classify::is_finite(args) && ...))
+        return certain;
+    outcome const o = result_outcome(pole, result, args...);
+    return checks::reports(o) ? o : outcome::valid;
+}
+
+// The result of a function for arguments certain to fail, infinity being the one of a pole error or an overflow
+template<class FP>
+FP certain_result(outcome certain, FP infinity)
+{
+    return certain == outcome::domain_error ? std::numeric_limits<FP>::quiet_NaN() : infinity;
+}
+
+// Calls f(args...) for the safe_float x, unless the failure is certain from the arguments and its result known, as
+// it isn't for an underflow
+template<class SF, class F, class... ARGS>
+SF call(SF& x, const char* name, bool pole, outcome certain, typename SF::value_type infinity, F f, ARGS... args)
+{
+    using FP = typename SF::value_type;
+    using checks = function_checks<FP, typename SF::check_policy>;
+    if constexpr (checks::any)
+        if (certain != outcome::valid && certain != outcome::underflow && checks::reports(certain)
+            && (policy::classify::is_finite(args) && ...))
+        {
+            x.report_failure(message(certain, name));
+            return SF(certain_result(certain, infinity));
+        }
+    FP const result = f(args...);
+    if constexpr (checks::any)
+    {
+        outcome const o = reported_outcome<FP, typename SF::check_policy>(pole, certain, result, args...);
+        if (o != outcome::valid) x.report_failure(message(o, name));
+    }
+    return SF(result);
+}
+} // namespace detail
+} // namespace math
+
+// infinite_result is the result of the arguments certain to give a pole error or an overflow, inf being +infinity
+#define BOOST_SAFE_FLOAT_CHECKED_UNARY_FUNCTION(name, pole, certain, infinite_result)                              \
+    template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>          \
+    safe_float<FP, CHECK, ERROR_HANDLING, CAST> name(safe_float<FP, CHECK, ERROR_HANDLING, CAST> x)                \
+    {                                                                                                              \
+        using math::detail::outcome;                                                                               \
+        FP const v = x.get_stored_value();                                                                         \
+        FP const inf = std::numeric_limits<FP>::infinity();                                                        \
+        return math::detail::call(x, #name, pole, certain, infinite_result, [](FP a) { return std::name(a); }, v); \
+    }
+
+#define BOOST_SAFE_FLOAT_CHECKED_BINARY_FUNCTION(name, pole, certain, infinite_result)                     \
+    template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>  \
+    safe_float<FP, CHECK, ERROR_HANDLING, CAST> name(safe_float<FP, CHECK, ERROR_HANDLING, CAST> x,        \
+                                                     const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& y) \
+    {                                                                                                      \
+        using math::detail::outcome;                                                                       \
+        FP const v = x.get_stored_value(), w = y.get_stored_value();                                       \
+        FP const inf = std::numeric_limits<FP>::infinity();                                                \
+        auto const f = [](FP a, FP b) { return std::name(a, b); };                                         \
+        return math::detail::call(x, #name, pole, certain, infinite_result, f, v, w);                      \
+    }
+
+// exponentials and logarithms
+BOOST_SAFE_FLOAT_CHECKED_UNARY_FUNCTION(exp, false, math::detail::exp_certain(v), inf)
+BOOST_SAFE_FLOAT_CHECKED_UNARY_FUNCTION(exp2, false,
+                                        v >= FP(std::numeric_limits<FP>::max_exponent)    ? outcome::overflow
+                                        : v < FP(std::numeric_limits<FP>::min_exponent - 2) ? outcome::underflow
+                                                                                            : outcome::valid, inf)
+BOOST_SAFE_FLOAT_CHECKED_UNARY_FUNCTION(expm1, false,
+                                        v > math::detail::exp_overflow_bound<FP> ? outcome::overflow : outcome::valid,
+                                        inf)
+BOOST_SAFE_FLOAT_CHECKED_UNARY_FUNCTION(log, true, math::detail::log_certain(v), -inf)
+BOOST_SAFE_FLOAT_CHECKED_UNARY_FUNCTION(log2, true, math::detail::log_certain(v), -inf)
+BOOST_SAFE_FLOAT_CHECKED_UNARY_FUNCTION(log10, true, math::detail::log_certain(v), -inf)
+BOOST_SAFE_FLOAT_CHECKED_UNARY_FUNCTION(log1p, true,
+                                        v < -1 ? outcome::domain_error : v == -1 ? outcome::pole_error : outcome::valid,
+                                        -inf)
+
+// powers
+BOOST_SAFE_FLOAT_CHECKED_UNARY_FUNCTION(cbrt, false, outcome::valid, inf)
+// pow(-0, w) is -inf for the odd negative integers w
+BOOST_SAFE_FLOAT_CHECKED_BINARY_FUNCTION(pow, false, math::detail::pow_certain(v, w),
+                                         std::signbit(v) && std::fmod(w, FP(2)) == -1 ? -inf : inf)
+BOOST_SAFE_FLOAT_CHECKED_BINARY_FUNCTION(hypot, false, outcome::valid, inf)
+
+// trigonometric and hyperbolic functions
+BOOST_SAFE_FLOAT_CHECKED_UNARY_FUNCTION(sin, false, outcome::valid, inf)
+BOOST_SAFE_FLOAT_CHECKED_UNARY_FUNCTION(cos, false, outcome::valid, inf)
+BOOST_SAFE_FLOAT_CHECKED_UNARY_FUNCTION(tan, false, outcome::valid, inf)
+BOOST_SAFE_FLOAT_CHECKED_UNARY_FUNCTION(asin, false, v < -1 || v > 1 ? outcome::domain_error : outcome::valid, inf)
+BOOST_SAFE_FLOAT_CHECKED_UNARY_FUNCTION(acos, false, v < -1 || v > 1 ? outcome::domain_error : outcome::valid, inf)
+BOOST_SAFE_FLOAT_CHECKED_UNARY_FUNCTION(atan, false, outcome::valid, inf)
+BOOST_SAFE_FLOAT_CHECKED_BINARY_FUNCTION(atan2, false, outcome::valid, inf)
+BOOST_SAFE_FLOAT_CHECKED_UNARY_FUNCTION(sinh, false,
+                                        std::fabs(v) > math::detail::exp_overflow_bound<FP> ? outcome::overflow
+                                                                                           : outcome::valid,
+                                        std::copysign(inf, v))
+BOOST_SAFE_FLOAT_CHECKED_UNARY_FUNCTION(cosh, false,
+                                        std::fabs(v) > math::detail::exp_overflow_bound<FP> ? outcome::overflow
+                                                                                           : outcome::valid, inf)
+BOOST_SAFE_FLOAT_CHECKED_UNARY_FUNCTION(tanh, false, outcome::valid, inf)
+
+#undef BOOST_SAFE_FLOAT_CHECKED_UNARY_FUNCTION
+#undef BOOST_SAFE_FLOAT_CHECKED_BINARY_FUNCTION
+
+// sqrt, the only function checked for inexact results: the square of an exact root is exactly the argument
+template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
+safe_float<FP, CHECK, ERROR_HANDLING, CAST> sqrt(safe_float<FP, CHECK, ERROR_HANDLING, CAST> x)
+{
+    using math::detail::outcome;
+    using checks = math::detail::function_checks<FP, CHECK<FP>>;
+    FP const v = x.get_stored_value();
+    auto const root =
+        math::detail::call(x, "sqrt", false, math::detail::sqrt_certain(v), std::numeric_limits<FP>::infinity(),
+                           [](FP a) { return std::sqrt(a); }, v);
+    if constexpr (checks::reports(outcome::inexact))
+        if (!math::detail::exact_root(v, root.get_stored_value()))
+            x.report_failure(math::detail::message(outcome::inexact, "sqrt"));
+    return root;
+}
+
+template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
+safe_float<FP, CHECK, ERROR_HANDLING, CAST> fma(safe_float<FP, CHECK, ERROR_HANDLING, CAST> x,
+                                                const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& y,
+                                                const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& z)
+{
+    return math::detail::call(
+        x, "fma", false, math::detail::outcome::valid, std::numeric_limits<FP>::infinity(),
+        [](FP a, FP b, FP c) { return std::fma(a, b, c); }, x.get_stored_value(), y.get_stored_value(),
+        z.get_stored_value());
+}
+
+// exact, never fails
+template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
+safe_float<FP, CHECK, ERROR_HANDLING, CAST> fabs(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& x)
+{
+    return safe_float<FP, CHECK, ERROR_HANDLING, CAST>(std::fabs(x.get_stored_value()));
+}
+
+template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
+safe_float<FP, CHECK, ERROR_HANDLING, CAST> abs(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>& x)
+{
+    return fabs(x);
+}
+
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_CMATH_HPP
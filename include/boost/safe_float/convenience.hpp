@@ -34,6 +34,11 @@
 #include <boost/safe_float/policy/check_multiplication_inexact.hpp>
 #include <boost/safe_float/policy/check_division_inexact.hpp>
 
+#include <boost/safe_float/policy/check_addition_inexact_eft.hpp>
+#include <boost/safe_float/policy/check_subtraction_inexact_eft.hpp>
+#include <boost/safe_float/policy/check_multiplication_inexact_eft.hpp>
+#include <boost/safe_float/policy/check_division_inexact_eft.hpp>
+
 #include <boost/safe_float/policy/check_addition_invalid_result.hpp>
 #include <boost/safe_float/policy/check_subtraction_invalid_result.hpp>
 #include <boost/safe_float/policy/check_multiplication_invalid_result.hpp>
@@ -41,6 +46,11 @@
 
 #include <boost/safe_float/policy/check_division_by_zero.hpp>
 
+#include <boost/safe_float/policy/check_addition_finite.hpp>
+#include <boost/safe_float/policy/check_subtraction_finite.hpp>
+#include <boost/safe_float/policy/check_multiplication_finite.hpp>
+#include <boost/safe_float/policy/check_division_finite.hpp>
+
 namespace boost {
 namespace safe_float{
 namespace policy{
@@ -72,6 +82,20 @@ using check_inexact_rounding = compose_check<check_addition_inexact,
                                             check_division_inexact,
                                             check_multiplication_inexact>::policy<FP>;
 
+// check_inexact_rounding computed with error-free transformations instead of the FE_INEXACT flag or round trips
+template<class FP>
+using check_inexact_rounding_eft = compose_check<check_addition_inexact_eft,
+                                                check_subtraction_inexact_eft,
+                                                check_division_inexact_eft,
+                                                check_multiplication_inexact_eft>::policy<FP>;
+
+// Any non finite result, the overflows, invalid results and divisions by zero with one test of the result
+template<class FP>
+using check_finite = compose_check<check_addition_finite,
+                                  check_subtraction_finite,
+                                  check_division_finite,
+                                  check_multiplication_finite>::policy<FP>;
+
 template<class FP>
 using check_bothflow = compose_check<check_overflow, check_underflow>::policy<FP>;
 
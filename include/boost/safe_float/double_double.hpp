@@ -0,0 +1,514 @@
+#ifndef BOOST_SAFE_FLOAT_DOUBLE_DOUBLE_HPP
+#define BOOST_SAFE_FLOAT_DOUBLE_DOUBLE_HPP
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+#include <boost/safe_float/fp_traits.hpp>
+#include <boost/safe_float/policy/error_free_transformation.hpp>
+
+// This file defines double_double, the unevaluated sum hi + lo of two doubles, |lo| being at most half an ulp of hi.
+// It has 104 bits of precision, the exponent range of double and can be the FP of a safe_float (see fp_traits.hpp).
+// The operations are computed by error-free transformations on the two parts: TwoSum (Knuth) for the sums, the
+// product error of error_free_transformation.hpp (a fma with FP_FAST_FMA, Dekker's product otherwise) for the products,
+// and one correction of the quotient of the high parts for the divisions. Their relative error is a few 2^-106, they
+// are not correctly rounded. The parts of a non finite value are the value and 0.
+// The precision is full while |hi| >= 2^-969, where the low part is a normal double: numeric_limits gives it as min()
+// and the smaller values are classified as subnormal, so the underflow checks report the loss of precision. The
+// operations on the parts raise FE_INEXACT, FE_UNDERFLOW and FE_INVALID without their result being inexact, small or
+// invalid: the values of a safe_float<double_double> are checked by the software checks in both builds.
+
+namespace boost
+{
+namespace safe_float
+{
+namespace detail
+{
+struct double_pair
+{
+    double hi;
+    double lo;
+};
+
+// comparisons only, false for inf and NaN
+constexpr bool is_finite_double(double value)
+{
+    return value <= std::numeric_limits<double>::max() && value >= -std::numeric_limits<double>::max();
+}
+
+// hi + lo == a + b exactly, hi being the rounding of a + b
+constexpr double_pair two_sum(double a, double b)
+{
+    double const s = a + b;
+    double const b_part = s - a;
+    return {s, (a - (s - b_part)) + (b - b_part)};
+}
+
+// the same when |a| >= |b|
+constexpr double_pair fast_two_sum(double a, double b)
+{
+    double const s = a + b;
+    return {s, b - (s - a)};
+}
+
+// hi + lo == a * b exactly when the product is not in the low range
+constexpr double_pair two_product(double a, double b)
+{
+    double const p = a * b;
+    return {p, policy::eft::detail::product_error(a, b, p)};
+}
+} // namespace detail
+
+class double_double
+{
+    double hi = 0;
+    double lo = 0;
+
+    struct parts_tag
+    {};
+
+    constexpr double_double(double high, double low, parts_tag) : hi(high), lo(low) {}
+
+    // high + low, |low| being small enough for high to be the rounded sum up to an ulp
+    static constexpr double_double renormalized(double high, double low)
+    {
+        detail::double_pair const s = detail::fast_two_sum(high, low);
+        return detail::is_finite_double(s.hi) ? double_double(s.hi, s.lo, parts_tag{})
+                                              : double_double(s.hi, 0, parts_tag{});
+    }
+
+public:
+    constexpr double_double() = default;
+
+    // The integers up to 64 bits and the long double values are split exactly when long double has 64 bits of
+    // precision
+    template<class T, std::enable_if_t<std::is_arithmetic<T>::value, int> = 0>
+    constexpr double_double(T value) : hi(static_cast<double>(value))
+    {
+        if constexpr (std::is_integral<T>::value || std::is_same<T, long double>::value)
+            if (detail::is_finite_double(hi))
+                lo = static_cast<double>(static_cast<long double>(value) - static_cast<long double>(hi));
+    }
+
+    // high + low rounded to a double_double
+    constexpr double_double(double high, double low)
+    {
+        detail::double_pair const s = detail::two_sum(high, low);
+        hi = s.hi;
+        lo = detail::is_finite_double(s.hi) ? s.lo : 0;
+    }
+
+    constexpr double high() const noexcept { return hi; }
+    constexpr double low() const noexcept { return lo; }
+
+    template<class T, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
+    constexpr explicit operator T() const noexcept
+    {
+        if constexpr (sizeof(T) > sizeof(double))
+            return static_cast<T>(hi) + static_cast<T>(lo);
+        else
+            return static_cast<T>(hi);
+    }
+
+    constexpr double_double operator-() const noexcept { return double_double(-hi, -lo, parts_tag{}); }
+    constexpr double_double operator+() const noexcept { return *this; }
+
+    friend constexpr double_double operator+(const double_double& lhs, const double_double& rhs)
+    {
+        detail::double_pair const s = detail::two_sum(lhs.hi, rhs.hi);
+        if (!detail::is_finite_double(s.hi)) return double_double(s.hi, 0, parts_tag{});
+        detail::double_pair const t = detail::two_sum(lhs.lo, rhs.lo);
+        detail::double_pair const v = detail::fast_two_sum(s.hi, s.lo + t.hi);
+        return renormalized(v.hi, t.lo + v.lo);
+    }
+
+    friend constexpr double_double operator-(const double_double& lhs, const double_double& rhs)
+    {
+        return lhs + -rhs;
+    }
+
+    friend constexpr double_double operator*(const double_double& lhs, const double_double& rhs)
+    {
+        detail::double_pair const p = detail::two_product(lhs.hi, rhs.hi);
+        if (!detail::is_finite_double(p.hi)) return double_double(p.hi, 0, parts_tag{});
+        return renormalized(p.hi, p.lo + (lhs.hi * rhs.lo + lhs.lo * rhs.hi));
+    }
+
+    // the quotient of the high parts corrected by the remainder lhs - q * rhs
+    friend constexpr double_double operator/(const double_double& lhs, const double_double& rhs)
+    {
+        double const q = lhs.hi / rhs.hi;
+        if (!detail::is_finite_double(q) || !detail::is_finite_double(rhs.hi))
+            return double_double(q, 0, parts_tag{});
+        detail::double_pair const p = detail::two_product(q, rhs.hi);
+        detail::double_pair const r = detail::two_sum(lhs.hi, -p.hi);
+        double const remainder = ((r.hi + (r.lo - p.lo)) + lhs.lo) - q * rhs.lo;
+        return renormalized(q, remainder / rhs.hi);
+    }
+
+    constexpr double_double& operator+=(const double_double& rhs) { return *this = *this + rhs; }
+    constexpr double_double& operator-=(const double_double& rhs) { return *this = *this - rhs; }
+    constexpr double_double& operator*=(const double_double& rhs) { return *this = *this * rhs; }
+    constexpr double_double& operator/=(const double_double& rhs) { return *this = *this / rhs; }
+
+    // the parts of a value are unique, the high parts are compared first
+    friend constexpr bool operator==(const double_double& lhs, const double_double& rhs)
+    {
+        return lhs.hi == rhs.hi && lhs.lo == rhs.lo;
+    }
+    friend constexpr bool operator!=(const double_double& lhs, const double_double& rhs) { return !(lhs == rhs); }
+    friend constexpr bool operator<(const double_double& lhs, const double_double& rhs)
+    {
+        return lhs.hi < rhs.hi || (lhs.hi == rhs.hi && lhs.lo < rhs.lo);
+    }
+    friend constexpr bool operator<=(const double_double& lhs, const double_double& rhs)
+    {
+        return lhs.hi < rhs.hi || (lhs.hi == rhs.hi && lhs.lo <= rhs.lo);
+    }
+    friend constexpr bool operator>(const double_double& lhs, const double_double& rhs) { return rhs < lhs; }
+    friend constexpr bool operator>=(const double_double& lhs, const double_double& rhs) { return rhs <= lhs; }
+
+    // classification, found by argument-dependent lookup
+    friend bool isinf(const double_double& value) { return std::isinf(value.hi); }
+    friend bool isnan(const double_double& value) { return std::isnan(value.hi); }
+    friend bool isfinite(const double_double& value) { return std::isfinite(value.hi); }
+    friend bool signbit(const double_double& value) { return std::signbit(value.hi); }
+    friend int fpclassify(const double_double& value);
+    friend constexpr double_double abs(const double_double& value) { return value.hi < 0 ? -value : value; }
+};
+
+} // namespace safe_float
+} // namespace boost
+
+namespace std
+{
+template<>
+class numeric_limits<boost::safe_float::double_double>
+{
+    using dd = boost::safe_float::double_double;
+
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr int digits = 104;
+    static constexpr int digits10 = 31;
+    static constexpr int max_digits10 = 33;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr int radix = 2;
+    // the low part is normal from 2^-969
+    static constexpr int min_exponent = -968;
+    static constexpr int min_exponent10 = -291;
+    static constexpr int max_exponent = 1024;
+    static constexpr int max_exponent10 = 308;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr bool has_signaling_NaN = true;
+    static constexpr float_denorm_style has_denorm = denorm_present;
+    static constexpr bool has_denorm_loss = false;
+    static constexpr bool is_iec559 = false;
+    static constexpr bool is_bounded = true;
+    static constexpr bool is_modulo = false;
+    static constexpr bool traps = false;
+    static constexpr bool tinyness_before = false;
+    static constexpr float_round_style round_style = round_indeterminate;
+
+    static constexpr dd min() noexcept { return dd(0x1p-969); }
+    // the low part is below half an ulp of the high part, the sum rounds to it
+    static constexpr dd max() noexcept
+    {
+        return dd(numeric_limits<double>::max(), 0x1.fffffffffffffp+969);
+    }
+    static constexpr dd lowest() noexcept { return -max(); }
+    static constexpr dd epsilon() noexcept { return dd(0x1p-104); }
+    static constexpr dd round_error() noexcept { return dd(0.5); }
+    static constexpr dd infinity() noexcept { return dd(numeric_limits<double>::infinity()); }
+    static constexpr dd quiet_NaN() noexcept { return dd(numeric_limits<double>::quiet_NaN()); }
+    static constexpr dd signaling_NaN() noexcept { return dd(numeric_limits<double>::signaling_NaN()); }
+    static constexpr dd denorm_min() noexcept { return dd(numeric_limits<double>::denorm_min()); }
+};
+} // namespace std
+
+namespace boost
+{
+namespace safe_float
+{
+// The values below numeric_limits<double_double>::min() are subnormal
+inline int fpclassify(const double_double& value)
+{
+    if (!std::isfinite(value.high()) || value.high() == 0) return std::fpclassify(value.high());
+    return abs(value) < std::numeric_limits<double_double>::min() ? FP_SUBNORMAL : FP_NORMAL;
+}
+
+template<>
+struct fp_traits<double_double>
+{
+    static constexpr bool is_floating_point = true;
+    static constexpr bool raises_fenv_flags = false;
+};
+
+namespace detail
+{
+// 10^n, n >= 0, by squaring
+inline double_double power_of_ten(int n)
+{
+    double_double result(1), square(10);
+    for (; n != 0; n >>= 1, square *= square)
+        if (n & 1) result *= square;
+    return result;
+}
+
+// value * 10^n, in two steps for the powers out of the double range
+inline double_double scale_by_power_of_ten(double_double value, int n)
+{
+    constexpr int step = 300;
+    if (n > step) return scale_by_power_of_ten(value * power_of_ten(step), n - step);
+    if (n < -step) return scale_by_power_of_ten(value / power_of_ten(step), n + step);
+    return n >= 0 ? value * power_of_ten(n) : value / power_of_ten(-n);
+}
+
+// The exponent of the first decimal digit of value > 0, scaled is value / 10^exponent in [1, 10)
+inline int decimal_exponent(double_double value, double_double& scaled)
+{
+    int exponent = int(std::floor(std::log10(value.high())));
+    scaled = scale_by_power_of_ten(value, -exponent);
+    if (scaled >= 10)
+    {
+        scaled /= 10;
+        ++exponent;
+    }
+    else if (scaled < 1)
+    {
+        scaled *= 10;
+        --exponent;
+    }
+    return exponent;
+}
+
+// The count first decimal digits of value > 0, rounded to nearest, and the exponent of the first one. The digits
+// after the 36th are not significant and not generated, the writers complete them by 0.
+inline std::string decimal_digits(double_double value, int count, int& exponent)
+{
+    constexpr int significant_digits = 36;
+    count = std::min(count, significant_digits);
+    double_double scaled;
+    exponent = decimal_exponent(value, scaled);
+    // one more digit to round
+    std::string digits;
+    for (int i = 0; i <= count; ++i)
+    {
+        int digit = int(scaled.high());
+        if (scaled - digit < 0) --digit;
+        digit = digit < 0 ? 0 : digit > 9 ? 9 : digit;
+        digits += char('0' + digit);
+        scaled = (scaled - digit) * 10;
+    }
+    bool const up = digits.back() >= '5';
+    digits.pop_back();
+    if (up)
+    {
+        std::size_t i = digits.size();
+        while (i > 0 && digits[i - 1] == '9') digits[--i] = '0';
+        if (i > 0)
+            ++digits[i - 1];
+        else
+        {
+            digits.insert(digits.begin(), '1');
+            digits.pop_back();
+            ++exponent;
+        }
+    }
+    return digits;
+}
+} // namespace detail
+
+// Written as a double would be with the same flags, the hexfloat format writes the high part only
+inline std::ostream& operator<<(std::ostream& out, const double_double& value)
+{
+    std::ios_base::fmtflags const flags = out.flags();
+    std::ios_base::fmtflags const format = flags & std::ios_base::floatfield;
+    if (!std::isfinite(value.high()) || value.high() == 0
+        || format == (std::ios_base::fixed | std::ios_base::scientific))
+        return out << value.high();
+
+    int const precision = int(out.precision());
+    std::string text = value.high() < 0 ? "-" : (flags & std::ios_base::showpos) ? "+" : "";
+    double_double const magnitude = abs(value);
+    char const exponent_mark = (flags & std::ios_base::uppercase) ? 'E' : 'e';
+    // digits with the point after the first point_position ones, completed by 0
+    bool const showpoint = (flags & std::ios_base::showpoint) != 0;
+    auto const append = [&text, showpoint](const std::string& digits, int point_position, int decimals) {
+        for (int i = 0; i < point_position; ++i) text += i < int(digits.size()) ? digits[i] : '0';
+        if (point_position <= 0) text += '0';
+        if (decimals > 0 || showpoint) text += '.';
+        for (int i = 0; i < decimals; ++i)
+        {
+            int const d = point_position + i;
+            text += d >= 0 && d < int(digits.size()) ? digits[d] : '0';
+        }
+    };
+    auto const append_exponent = [&text, exponent_mark](int exponent) {
+        char buffer[8];
+        std::snprintf(buffer, sizeof(buffer), "%c%+03d", exponent_mark, exponent);
+        text += buffer;
+    };
+
+    int exponent = 0;
+    if (format == std::ios_base::scientific)
+    {
+        std::string const digits = detail::decimal_digits(magnitude, precision + 1, exponent);
+        append(digits, 1, precision);
+        append_exponent(exponent);
+    }
+    else if (format == std::ios_base::fixed)
+    {
+        double_double scaled;
+        exponent = detail::decimal_exponent(magnitude, scaled);
+        int const count = exponent + 1 + precision;
+        std::string digits;
+        if (count > 0)
+            // rounded up to the next power of 10, the last 0 is added by append
+            digits = detail::decimal_digits(magnitude, count, exponent);
+        else if (detail::scale_by_power_of_ten(magnitude, precision) >= 0.5)
+        {
+            digits = "1";
+            exponent = -precision;
+        }
+        append(digits, exponent + 1, precision);
+    }
+    else
+    {
+        // the shortest of fixed and scientific for precision significant digits, without the trailing zeros
+        int const significant = precision == 0 ? 1 : precision;
+        std::string const digits = detail::decimal_digits(magnitude, significant, exponent);
+        bool const scientific = exponent < -4 || exponent >= significant;
+        std::size_t const mantissa_start = text.size();
+        if (scientific)
+            append(digits, 1, significant - 1);
+        else
+            append(digits, exponent + 1, significant - 1 - exponent);
+        if (!showpoint && text.find('.', mantissa_start) != std::string::npos)
+        {
+            text.erase(text.find_last_not_of('0') + 1);
+            if (text.back() == '.') text.pop_back();
+        }
+        if (scientific) append_exponent(exponent);
+    }
+    return out << text;
+}
+
+// Reads [sign] digits [. digits] [e [sign] digits], inf, infinity or nan. Out of range values set failbit and store
+// the largest finite value, as for double, the values rounding to it are read as it.
+inline std::istream& operator>>(std::istream& in, double_double& value)
+{
+    std::istream::sentry const sentry(in);
+    if (!sentry) return in;
+    // the characters are taken from the buffer, eofbit is set once at the end as by the num_get of double
+    using traits = std::char_traits<char>;
+    std::streambuf& buffer = *in.rdbuf();
+    std::ios_base::iostate state = std::ios_base::goodbit;
+    auto const next_is = [&buffer](auto predicate) {
+        traits::int_type const c = buffer.sgetc();
+        return !traits::eq_int_type(c, traits::eof()) && predicate(traits::to_char_type(c));
+    };
+    auto const take = [&buffer] { return traits::to_char_type(buffer.sbumpc()); };
+    auto const finish = [&]() -> std::istream& {
+        if (traits::eq_int_type(buffer.sgetc(), traits::eof())) state |= std::ios_base::eofbit;
+        in.setstate(state);
+        return in;
+    };
+    auto const is_digit = [](char c) { return c >= '0' && c <= '9'; };
+    auto const is_sign = [](char c) { return c == '+' || c == '-'; };
+    auto const is_alpha = [](char c) { return std::isalpha(static_cast<unsigned char>(c)) != 0; };
+
+    bool negative = false;
+    if (next_is(is_sign)) negative = take() == '-';
+    if (next_is(is_alpha))
+    {
+        std::string word;
+        while (next_is(is_alpha)) word += char(std::tolower(static_cast<unsigned char>(take())));
+        if (word == "inf" || word == "infinity")
+            value = negative ? -std::numeric_limits<double>::infinity() : std::numeric_limits<double>::infinity();
+        else if (word == "nan")
+            value = std::numeric_limits<double>::quiet_NaN();
+        else
+            state |= std::ios_base::failbit;
+        return finish();
+    }
+
+    // up to 36 significant digits are accumulated exactly enough, the others only move the exponent
+    constexpr int kept_digits = 36;
+    double_double mantissa;
+    int significant = 0, exponent = 0;
+    bool has_digits = false;
+    auto const read_digit = [&](bool fractional) {
+        int const digit = take() - '0';
+        has_digits = true;
+        if (significant == 0 && digit == 0)
+        {
+            if (fractional) --exponent;
+            return;
+        }
+        if (significant < kept_digits)
+        {
+            mantissa = mantissa * 10 + digit;
+            ++significant;
+            if (fractional) --exponent;
+        }
+        else if (!fractional)
+            ++exponent;
+    };
+    while (next_is(is_digit)) read_digit(false);
+    if (next_is([](char c) { return c == '.'; }))
+    {
+        take();
+        while (next_is(is_digit)) read_digit(true);
+    }
+    if (!has_digits)
+    {
+        state |= std::ios_base::failbit;
+        return finish();
+    }
+    if (next_is([](char c) { return c == 'e' || c == 'E'; }))
+    {
+        take();
+        bool negative_exponent = false;
+        if (next_is(is_sign)) negative_exponent = take() == '-';
+        if (!next_is(is_digit))
+        {
+            state |= std::ios_base::failbit;
+            return finish();
+        }
+        int written = 0;
+        while (next_is(is_digit))
+        {
+            int const digit = take() - '0';
+            if (written < 100000) written = written * 10 + digit;
+        }
+        exponent += negative_exponent ? -written : written;
+    }
+
+    double_double result = significant == 0 ? double_double(0) : detail::scale_by_power_of_ten(mantissa, exponent);
+    if (!std::isfinite(result.high()))
+    {
+        double_double const max = std::numeric_limits<double_double>::max();
+        double_double const tenth = detail::scale_by_power_of_ten(mantissa, exponent - 1);
+        if (!(std::isfinite(tenth.high()) && tenth - max / 10 <= max / 10 * std::ldexp(1.0, -100)))
+            state |= std::ios_base::failbit;
+        result = max;
+    }
+    value = negative ? -result : result;
+    return finish();
+}
+
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_DOUBLE_DOUBLE_HPP
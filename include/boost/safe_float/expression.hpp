@@ -0,0 +1,212 @@
+#ifndef BOOST_SAFE_FLOAT_EXPRESSION_HPP
+#define BOOST_SAFE_FLOAT_EXPRESSION_HPP
+
+#include <type_traits>
+
+#include <boost/safe_float/policy/fenv_flags.hpp>
+#include <boost/safe_float/policy/fused_checker.hpp>
+#include <boost/safe_float/policy/policy_traits.hpp>
+#include <boost/safe_float/utility.hpp>
+
+// This file defines the expression templates used by the binary operators when BOOST_SAFE_FLOAT_EXPRESSION_TEMPLATES
+// is defined. An expression like a*b + c*d - e builds a tree, evaluated when it is assigned to a safe_float:
+// - the FE_* flags of the whole tree are cleared once before and tested once after the evaluation,
+// - the software checks are evaluated for every node, without branching nor reporting,
+// - only when something failed, the tree is evaluated again node by node with the reporting checks of the policy,
+//   so the failure reported is the one of the first node failing, as with the eager operators.
+// Expressions hold references to their safe_float operands, they are meant to be assigned in the statement building
+// them, not to be kept in an auto variable.
+
+namespace boost
+{
+namespace safe_float
+{
+template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
+class safe_float;
+
+namespace expression
+{
+namespace detail
+{
+#define BOOST_SAFE_FLOAT_EXPRESSION_OPERATION(name, operation, OP)                                   \
+    struct name                                                                                      \
+    {                                                                                                \
+        template<class FP>                                                                           \
+        static FP apply(FP lhs, FP rhs)                                                              \
+        {                                                                                            \
+            return lhs OP rhs;                                                                       \
+        }                                                                                            \
+        template<class FP, class POLICY>                                                             \
+        static constexpr int fenv_flags = policy::fused_checker<FP, POLICY>::operation##_fenv_flags; \
+        template<class FP, class POLICY>                                                             \
+        static bool check(FP lhs, FP rhs, FP result)                                                 \
+        {                                                                                            \
+            return policy::fused_checker<FP, POLICY>::operation##_check(lhs, rhs, result);           \
+        }                                                                                            \
+        template<class FP, class POLICY, class ERROR_HANDLING>                                       \
+        static FP apply_reporting(POLICY& p, FP lhs, FP rhs, ERROR_HANDLING& e)                      \
+        {                                                                                            \
+            return policy::detail::checked_##operation(p, lhs, rhs, e);                              \
+        }                                                                                            \
+    };
+
+BOOST_SAFE_FLOAT_EXPRESSION_OPERATION(add, addition, +)
+BOOST_SAFE_FLOAT_EXPRESSION_OPERATION(subtract, subtraction, -)
+BOOST_SAFE_FLOAT_EXPRESSION_OPERATION(multiply, multiplication, *)
+BOOST_SAFE_FLOAT_EXPRESSION_OPERATION(divide, division, /)
+
+#undef BOOST_SAFE_FLOAT_EXPRESSION_OPERATION
+} // namespace detail
+
+// Leaf of an expression, a safe_float operand
+template<class SF>
+class leaf
+{
+    SF const& operand;
+
+public:
+    using safe_float_type = SF;
+    using value_type = typename SF::value_type;
+    using check_policy = typename SF::check_policy;
+
+    static constexpr int fenv_flags = 0;
+
+    explicit leaf(SF const& operand) : operand(operand) {}
+
+    value_type evaluate_checked(bool&) const
+    {
+        value_type value = operand.get_stored_value();
+        policy::fenv_flags::fence<value_type>(value);
+        return value;
+    }
+
+    template<class ERROR_HANDLING>
+    value_type evaluate_reporting(check_policy&, ERROR_HANDLING&) const
+    {
+        return operand.get_stored_value();
+    }
+};
+
+template<class OP, class L, class R>
+class binary_expression
+{
+    L lhs;
+    R rhs;
+
+public:
+    using safe_float_type = typename L::safe_float_type;
+    using value_type = typename L::value_type;
+    using check_policy = typename L::check_policy;
+
+    // FE_* flags used by the checks of the whole tree
+    static constexpr int fenv_flags =
+        L::fenv_flags | R::fenv_flags | OP::template fenv_flags<value_type, check_policy>;
+
+    binary_expression(L const& lhs, R const& rhs) : lhs(lhs), rhs(rhs) {}
+
+    // Evaluates the tree, ok is cleared when a software check fails
+    value_type evaluate_checked(bool& ok) const
+    {
+        value_type const l = lhs.evaluate_checked(ok);
+        value_type const r = rhs.evaluate_checked(ok);
+        value_type result = OP::apply(l, r);
+        // every node is rounded and raises its flags, as the eager operators do
+        policy::fenv_flags::fence<value_type>(result);
+        ok &= OP::template check<value_type, check_policy>(l, r, result);
+        return result;
+    }
+
+    // Evaluates the tree with the checks reporting to the handler, as the eager operators do
+    template<class ERROR_HANDLING>
+    value_type evaluate_reporting(check_policy& p, ERROR_HANDLING& e) const
+    {
+        value_type const l = lhs.evaluate_reporting(p, e);
+        value_type const r = rhs.evaluate_reporting(p, e);
+        return OP::apply_reporting(p, l, r, e);
+    }
+
+    // Evaluates the whole expression checked once
+    template<class ERROR_HANDLING>
+    value_type evaluate(ERROR_HANDLING& e) const
+    {
+        if constexpr (fenv_flags != 0) policy::fenv_flags::clear<value_type>(fenv_flags);
+        bool ok = true;
+        value_type result = evaluate_checked(ok);
+        policy::fenv_flags::fence<value_type>(result);
+        if constexpr (fenv_flags != 0) ok &= !policy::fenv_flags::test<value_type>(fenv_flags);
+        if (!ok)
+        {
+            // rare path: find the failing node
+            check_policy p{};
+            result = evaluate_reporting(p, e);
+        }
+        return result;
+    }
+};
+
+template<class T>
+struct is_expression : std::false_type
+{};
+
+template<class OP, class L, class R>
+struct is_expression<binary_expression<OP, L, R>> : std::true_type
+{};
+
+// Operands of the operators, safe_float are wrapped in leaves
+template<class T>
+T const& as_node(T const& node)
+{
+    return node;
+}
+
+template<class FP, template<class T> class CHECK, class ERROR_HANDLING, template<class T> class CAST>
+leaf<boost::safe_float::safe_float<FP, CHECK, ERROR_HANDLING, CAST>>
+as_node(boost::safe_float::safe_float<FP, CHECK, ERROR_HANDLING, CAST> const& operand)
+{
+    return leaf<boost::safe_float::safe_float<FP, CHECK, ERROR_HANDLING, CAST>>(operand);
+}
+
+template<class T>
+using node_t = std::decay_t<decltype(as_node(std::declval<T const&>()))>;
+
+template<class T>
+constexpr bool is_operand = boost::safe_float::is_safe_float<T>::value || is_expression<T>::value;
+
+// Both operands are safe_float or expressions, of the same safe_float type
+template<class L, class R, class = void>
+struct are_operands : std::false_type
+{};
+
+template<class L, class R>
+struct are_operands<L, R, std::enable_if_t<is_operand<L> && is_operand<R>>> :
+    std::is_same<typename node_t<L>::safe_float_type, typename node_t<R>::safe_float_type>
+{};
+
+} // namespace expression
+
+#define BOOST_SAFE_FLOAT_EXPRESSION_OPERATOR(OP, operation)                                                    \
+    template<class L, class R, std::enable_if_t<expression::are_operands<L, R>::value, int> = 0>               \
+    expression::binary_expression<expression::detail::operation, expression::node_t<L>, expression::node_t<R>> \
+    operator OP(L const& lhs, R const& rhs)                                                                    \
+    {                                                                                                          \
+        return {expression::as_node(lhs), expression::as_node(rhs)};                                           \
+    }
+
+BOOST_SAFE_FLOAT_EXPRESSION_OPERATOR(+, add)
+BOOST_SAFE_FLOAT_EXPRESSION_OPERATOR(-, subtract)
+BOOST_SAFE_FLOAT_EXPRESSION_OPERATOR(*, multiply)
+BOOST_SAFE_FLOAT_EXPRESSION_OPERATOR(/, divide)
+
+#undef BOOST_SAFE_FLOAT_EXPRESSION_OPERATOR
+
+// Negation is not checked, the operand is evaluated first
+template<class OP, class L, class R>
+typename L::safe_float_type operator-(const expression::binary_expression<OP, L, R>& operand)
+{
+    return -typename L::safe_float_type(operand);
+}
+
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_EXPRESSION_HPP
@@ -0,0 +1,37 @@
+#ifndef BOOST_SAFE_FLOAT_FP_TRAITS_HPP
+#define BOOST_SAFE_FLOAT_FP_TRAITS_HPP
+
+#include <type_traits>
+
+// This file defines the requirements on the FP of a safe_float. The primitive floating point types meet them, other
+// types are declared by specializing fp_traits, and provide:
+// - std::numeric_limits<FP> with every member,
+// - default construction and construction from int, float and double,
+// - the arithmetic operators, the unary minus and the comparisons, with FP operands,
+// - isinf, isnan, isfinite and fpclassify found by argument-dependent lookup, classifying the values for the software
+//   checks (see policy/classify.hpp),
+// - operator<< and operator>> on the standard streams, for the ones of safe_float.
+// raises_fenv_flags states that the operations of FP raise the FE_* flags of the IEEE-754 operation giving their
+// result. The checks of the fenv build test the flags for the types raising them only, the other types are checked by
+// the software checks in both builds. The error-free transformations of the check_*_inexact_eft policies and the
+// batch, SIMD and validation kernels need the primitive types.
+
+namespace boost
+{
+namespace safe_float
+{
+template<class FP, class = void>
+struct fp_traits
+{
+    static constexpr bool is_floating_point = std::is_floating_point<FP>::value;
+    static constexpr bool raises_fenv_flags = std::is_floating_point<FP>::value;
+};
+
+// FP can be the value of a safe_float
+template<class FP>
+constexpr bool is_floating_point_type = fp_traits<FP>::is_floating_point;
+
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_FP_TRAITS_HPP
@@ -0,0 +1,285 @@
+#ifndef BOOST_SAFE_FLOAT_INGEST_HPP
+#define BOOST_SAFE_FLOAT_INGEST_HPP
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#if __has_include(<sys/mman.h>)
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#    define BOOST_SAFE_FLOAT_HAS_MAPPED_FILE
+#endif
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/validate.hpp>
+
+// This file defines the parsing of delimited numeric text, one row per line, straight into columns of safe_float.
+// The text is split in chunks of whole lines parsed by several threads. The failures are collected by the threads and
+// reported in the order of the rows by the calling thread once the chunks are parsed.
+
+namespace boost
+{
+namespace safe_float
+{
+namespace ingest
+{
+struct options
+{
+    // ' ' separates the values by any run of spaces and tabs
+    char delimiter = ',';
+    // lines skipped before the first row, like a header
+    std::size_t skip_rows = 0;
+    // threads parsing the chunks, 0 for std::thread::hardware_concurrency()
+    unsigned threads = 0;
+};
+
+namespace detail
+{
+template<typename ERROR_HANDLING, typename = std::void_t<>>
+struct has_report_parse_failure : std::false_type
+{};
+
+template<typename ERROR_HANDLING>
+struct has_report_parse_failure<ERROR_HANDLING,
+                                std::void_t<decltype(std::declval<ERROR_HANDLING&>().report_parse_failure(
+                                    std::declval<const std::string&>(), std::declval<std::size_t>(),
+                                    std::declval<std::size_t>()))>> : std::true_type
+{};
+
+template<typename ERROR_HANDLING>
+void report_parse_failure(ERROR_HANDLING& handler, const std::string& message, std::size_t row, std::size_t column)
+{
+    if constexpr (has_report_parse_failure<ERROR_HANDLING>::value)
+        handler.report_parse_failure(message, row, column);
+    else
+        handler.report_failure(message + " (row " + std::to_string(row) + ", column " + std::to_string(column) + ")");
+}
+
+// A failure found by a thread, reported once every chunk is parsed
+struct parse_failure
+{
+    std::size_t row;
+    std::size_t column;
+    const char* message;
+};
+
+inline bool is_blank(char c)
+{
+    return c == ' ' or c == '\t';
+}
+
+inline const char* skip_blanks(const char* first, const char* last)
+{
+    while (first != last and is_blank(*first)) ++first;
+    return first;
+}
+
+inline const char* end_of_line(const char* first, const char* last)
+{
+    auto const eol = static_cast<const char*>(std::memchr(first, '\n', std::size_t(last - first)));
+    return eol ? eol : last;
+}
+
+// Beginning of the line after first, last when there is none
+inline const char* next_line(const char* first, const char* last)
+{
+    const char* const eol = end_of_line(first, last);
+    return eol == last ? last : eol + 1;
+}
+
+// Lines in [first, last), the last one may miss its '\n'
+inline std::size_t count_lines(const char* first, const char* last)
+{
+    std::size_t const newlines = std::size_t(std::count(first, last, '\n'));
+    return newlines + (first != last and last[-1] != '\n' ? 1 : 0);
+}
+
+template<typename SF>
+void parse_row(const char* first, const char* last, std::size_t row, SF* const* columns, std::size_t column_count,
+               char delimiter, std::vector<parse_failure>& failures)
+{
+    using FP = typename SF::value_type;
+    if (first != last and last[-1] == '\r') --last;
+    bool const blanks = delimiter == ' ';
+    const char* p = first;
+    for (std::size_t column = 0; column < column_count; ++column)
+    {
+        if (blanks) p = skip_blanks(p, last);
+        if (column > 0 and !blanks)
+        {
+            // p is on the delimiter ending the previous value
+            if (p == last)
+            {
+                failures.push_back({row, column, "Missing value"});
+                return;
+            }
+            ++p;
+        }
+        const char* field_last = p;
+        if (blanks)
+            while (field_last != last and !is_blank(*field_last)) ++field_last;
+        else
+            while (field_last != last and *field_last != delimiter) ++field_last;
+
+        const char* const value_first = skip_blanks(p, field_last);
+        const char* value_last = field_last;
+        while (value_last != value_first and is_blank(value_last[-1])) --value_last;
+        p = field_last;
+        if (value_first == value_last)
+        {
+            failures.push_back({row, column, "Missing value"});
+            if (p == last) return;
+            continue;
+        }
+        FP number{};
+        auto const result = std::from_chars(value_first, value_last, number);
+        if (result.ec == std::errc::result_out_of_range)
+            failures.push_back({row, column, "Floating point number out of range"});
+        else if (result.ec != std::errc{} or result.ptr != value_last)
+            failures.push_back({row, column, "Not a valid floating point number"});
+        else
+        {
+            // the cast policies report nothing, the values SF doesn't hold are rejected as by the validation of arrays
+            auto const rejected = validation::detail::classify_value<validation::rejected_by<SF>()>(number);
+            if (rejected != validation::value_class::none)
+                failures.push_back({row, column, validation::detail::message(rejected)});
+            else
+                columns[column][row] = SF(number);
+        }
+    }
+    if (skip_blanks(p, last) != last) failures.push_back({row, column_count, "Too many values"});
+}
+
+// Parses the rows of [first, last) from row, until capacity
+template<typename SF>
+void parse_chunk(const char* first, const char* last, std::size_t row, SF* const* columns, std::size_t column_count,
+                 std::size_t capacity, char delimiter, std::vector<parse_failure>& failures)
+{
+    for (; first != last and row < capacity; ++row)
+    {
+        const char* const eol = end_of_line(first, last);
+        parse_row(first, eol, row, columns, column_count, delimiter, failures);
+        first = eol == last ? last : eol + 1;
+    }
+}
+} // namespace detail
+
+// Rows of the text after the skipped lines, to size the columns
+inline std::size_t count_rows(const char* first, const char* last, const options& opts = options{})
+{
+    for (std::size_t i = 0; i < opts.skip_rows; ++i) first = detail::next_line(first, last);
+    return detail::count_lines(first, last);
+}
+
+// Parses the rows of [first, last) into columns[0..column_count), each holding capacity values, and returns the rows
+// read. The values are converted from FP through the cast policy of SF, the non finite ones, and the subnormal ones
+// when SF checks underflows, are failures (see validation::rejected_by). A failure is given to the handler with the
+// row and the column of the value, from 0, through report_parse_failure(message, row, column) when it provides it,
+// otherwise they are appended to the message given to report_failure. The values failing are left unchanged.
+template<typename SF, typename ERROR_HANDLING = typename SF::report_policy>
+std::size_t read_columns(const char* first, const char* last, SF* const* columns, std::size_t column_count,
+                         std::size_t capacity, const options& opts = options{},
+                         ERROR_HANDLING handler = ERROR_HANDLING{})
+{
+    static_assert(is_safe_float<SF>::value, "The columns are made of safe_float");
+    for (std::size_t i = 0; i < opts.skip_rows; ++i) first = detail::next_line(first, last);
+
+    // chunks of whole lines, at least a few pages each to make the threads worth it
+    constexpr std::size_t min_chunk = 1 << 16;
+    std::size_t const length = std::size_t(last - first);
+    std::size_t threads = opts.threads != 0 ? opts.threads : std::max(1u, std::thread::hardware_concurrency());
+    threads = std::max<std::size_t>(1, std::min(threads, length / min_chunk));
+    std::vector<const char*> bounds{first};
+    for (std::size_t i = 1; i < threads; ++i)
+    {
+        const char* const middle = std::max(bounds.back(), first + length * i / threads);
+        bounds.push_back(middle == first ? first : detail::next_line(middle - 1, last));
+    }
+    bounds.push_back(last);
+    std::size_t const chunks = bounds.size() - 1;
+
+    // first row of every chunk, then the chunks are parsed
+    std::vector<std::size_t> rows(chunks + 1, 0);
+    std::vector<std::vector<detail::parse_failure>> failures(chunks);
+    auto const in_parallel = [chunks](auto&& work) {
+        std::vector<std::thread> workers;
+        for (std::size_t i = 1; i < chunks; ++i) workers.emplace_back(work, i);
+        work(0);
+        for (auto& w : workers) w.join();
+    };
+    in_parallel([&](std::size_t i) { rows[i + 1] = detail::count_lines(bounds[i], bounds[i + 1]); });
+    for (std::size_t i = 0; i < chunks; ++i) rows[i + 1] += rows[i];
+    in_parallel([&](std::size_t i) {
+        detail::parse_chunk(bounds[i], bounds[i + 1], rows[i], columns, column_count, capacity, opts.delimiter,
+                            failures[i]);
+    });
+
+    for (auto const& chunk : failures)
+        for (auto const& f : chunk) detail::report_parse_failure(handler, f.message, f.row, f.column);
+    if (rows[chunks] > capacity)
+        handler.report_failure("More rows than the capacity of the columns (" + std::to_string(rows[chunks]) + ")");
+    return std::min(rows[chunks], capacity);
+}
+
+#ifdef BOOST_SAFE_FLOAT_HAS_MAPPED_FILE
+// Read only mapping of a whole file, std::system_error is thrown when it can't be opened or mapped
+class mapped_file
+{
+    const char* data = nullptr;
+    std::size_t size = 0;
+
+public:
+    explicit mapped_file(const char* path)
+    {
+        int const fd = ::open(path, O_RDONLY);
+        if (fd < 0) throw std::system_error(errno, std::generic_category(), path);
+        struct stat status;
+        if (::fstat(fd, &status) != 0)
+        {
+            int const error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), path);
+        }
+        size = std::size_t(status.st_size);
+        if (size != 0)
+        {
+            void* const mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping == MAP_FAILED)
+            {
+                int const error = errno;
+                ::close(fd);
+                throw std::system_error(error, std::generic_category(), path);
+            }
+            data = static_cast<const char*>(mapping);
+        }
+        ::close(fd);
+    }
+
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    ~mapped_file()
+    {
+        if (data) ::munmap(const_cast<char*>(data), size);
+    }
+
+    const char* begin() const noexcept { return data; }
+    const char* end() const noexcept { return data + size; }
+};
+#endif
+
+} // namespace ingest
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_INGEST_HPP
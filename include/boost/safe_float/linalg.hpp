@@ -0,0 +1,481 @@
+#ifndef BOOST_SAFE_FLOAT_LINALG_HPP
+#define BOOST_SAFE_FLOAT_LINALG_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/batch.hpp>
+#include <boost/safe_float/policy/fused_checker.hpp>
+#include <boost/safe_float/simd.hpp>
+
+// This file defines the dot product, axpy, the matrix-vector and the matrix-matrix products over contiguous arrays of
+// safe_float having the layout of their FP, the matrices being stored by rows.
+// A multiply-add is a product then a sum, both rounded and checked by the CHECK of the safe_float as its operators
+// do. The float and double values are computed by vectors of the widest registers of the target and checked as vector
+// masks by the lane checks of simd.hpp, the FE_* flags are cleared and tested once per tile of values. When a tile
+// fails, its operations are replayed lane by lane with the scalar checks: the replay computes the same values as the
+// vectors, in the same order, and finds the first failure. long double values are computed one by one, checked the
+// same way.
+
+namespace boost
+{
+namespace safe_float
+{
+namespace linalg
+{
+namespace detail
+{
+// values multiplied and added between two tests of the FE_* flags
+constexpr std::size_t tile_size = 2048;
+
+template<class FP>
+constexpr bool vectorized = std::is_same<FP, float>::value || std::is_same<FP, double>::value;
+
+template<class FP>
+constexpr std::size_t lanes = vectorized<FP> ? policy::fenv_flags::detail::vector_register_size / sizeof(FP) : 1;
+
+// the vectors of the widest registers of the target, a single FP for long double
+template<class FP, bool = vectorized<FP>>
+struct lane_vector
+{
+    using type = typename simd::detail::vector<FP, lanes<FP>>::type;
+    using mask = typename simd::detail::vector<FP, lanes<FP>>::mask;
+};
+
+template<class FP>
+struct lane_vector<FP, false>
+{
+    using type = FP;
+    using mask = bool;
+};
+
+template<class FP>
+using vec = typename lane_vector<FP>::type;
+
+template<class FP>
+vec<FP> load(const FP* p)
+{
+    vec<FP> v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+template<class FP>
+void store(FP* p, const vec<FP>& v)
+{
+    std::memcpy(p, &v, sizeof(v));
+}
+
+template<class FP>
+vec<FP> broadcast(FP value)
+{
+    return vec<FP>{} + value;
+}
+
+// Operations of the kernels checked without reporting: the software checks are accumulated as lane masks, the FE_*
+// flags are left to the kernels
+template<class FP, class POLICY>
+struct checking_step
+{
+    using lanes_checker = simd::detail::simd_checker<FP, lanes<FP>, POLICY>;
+    using checker = policy::fused_checker<FP, POLICY>;
+    static constexpr int flags = checker::multiplication_fenv_flags | checker::addition_fenv_flags;
+
+    typename lane_vector<FP>::mask failing{};
+    bool ok = true;
+
+    FP multiply_add(FP acc, FP lhs, FP rhs, std::size_t)
+    {
+        FP product = lhs * rhs;
+        policy::fenv_flags::fence<FP>(product);
+        FP const sum = acc + product;
+        ok &= checker::multiplication_check(lhs, rhs, product) & checker::addition_check(acc, product, sum);
+        return sum;
+    }
+
+    FP add(FP lhs, FP rhs, std::size_t)
+    {
+        FP const sum = lhs + rhs;
+        ok &= checker::addition_check(lhs, rhs, sum);
+        return sum;
+    }
+
+    template<class V, class INDEX>
+    V lanes_multiply_add(const V& acc, const V& lhs, const V& rhs, INDEX)
+    {
+        V product = lhs * rhs;
+        policy::fenv_flags::fence<FP>(product);
+        V const sum = acc + product;
+        failing |= lanes_checker::multiplication_failures(lhs, rhs, product)
+                   | lanes_checker::addition_failures(acc, product, sum);
+        return sum;
+    }
+
+    template<class V, class INDEX>
+    V lanes_add(const V& lhs, const V& rhs, INDEX)
+    {
+        V const sum = lhs + rhs;
+        failing |= lanes_checker::addition_failures(lhs, rhs, sum);
+        return sum;
+    }
+
+    // true when an operation failed since the flags were cleared
+    bool failed()
+    {
+        bool failure = !ok;
+        if constexpr (vectorized<FP>) failure |= simd::detail::any_lane<FP, lanes<FP>>(failing);
+        if constexpr (flags != 0) failure |= policy::fenv_flags::test<FP>(flags) != 0;
+        failing = typename lane_vector<FP>::mask{};
+        ok = true;
+        return failure;
+    }
+
+    void restart()
+    {
+        if constexpr (flags != 0) policy::fenv_flags::clear<FP>(flags);
+    }
+};
+
+// The same operations checked one by one by the scalar checks, the first failure is kept with its index
+template<class FP, class POLICY>
+struct replay_step
+{
+    POLICY p{};
+    policy::detail::capture_failure capture;
+    std::size_t index = 0;
+
+    FP multiply_add(FP acc, FP lhs, FP rhs, std::size_t i)
+    {
+        bool const failed = capture.failed;
+        FP const product = policy::detail::checked_multiplication(p, lhs, rhs, capture);
+        FP const sum = policy::detail::checked_addition(p, acc, product, capture);
+        if (!failed && capture.failed) index = i;
+        return sum;
+    }
+
+    FP add(FP lhs, FP rhs, std::size_t i)
+    {
+        bool const failed = capture.failed;
+        FP const sum = policy::detail::checked_addition(p, lhs, rhs, capture);
+        if (!failed && capture.failed) index = i;
+        return sum;
+    }
+
+    // index(lane) is the index reported for the lane
+    template<class V, class INDEX>
+    V lanes_multiply_add(const V& acc, const V& lhs, const V& rhs, INDEX index_of)
+    {
+        V sum{};
+        for (std::size_t l = 0; l < lanes<FP>; ++l) sum[l] = multiply_add(acc[l], lhs[l], rhs[l], index_of(l));
+        return sum;
+    }
+
+    template<class V, class INDEX>
+    V lanes_add(const V& lhs, const V& rhs, INDEX index_of)
+    {
+        V sum{};
+        for (std::size_t l = 0; l < lanes<FP>; ++l) sum[l] = add(lhs[l], rhs[l], index_of(l));
+        return sum;
+    }
+};
+
+// The dot product is accumulated by accumulators vectors, element i in the lane i % lanes of the accumulator
+// (i / lanes) % accumulators, then the accumulators and their lanes are summed and the last values are added
+constexpr std::size_t accumulators = 4;
+
+template<class FP>
+using accumulator_set = vec<FP>[accumulators];
+
+template<class FP>
+constexpr std::size_t block = accumulators * lanes<FP>;
+
+// Accumulates the blocks of [first, last), a multiple of block<FP>
+template<class FP, class STEP>
+void accumulate_blocks(accumulator_set<FP>& acc, const FP* x, const FP* y, std::size_t first, std::size_t last,
+                       STEP& step)
+{
+    for (std::size_t i = first; i < last; i += block<FP>)
+        for (std::size_t k = 0; k < accumulators; ++k)
+        {
+            std::size_t const j = i + k * lanes<FP>;
+            if constexpr (vectorized<FP>)
+                acc[k] = step.lanes_multiply_add(acc[k], load(x + j), load(y + j),
+                                                 [j](std::size_t l) { return j + l; });
+            else
+                acc[k] = step.multiply_add(acc[k], x[j], y[j], j);
+        }
+}
+
+// Sums the accumulators, their lanes, then adds the products from first to size. Their failures are reported with
+// sum_index.
+template<class FP, class STEP>
+FP finish_dot(const accumulator_set<FP>& acc, const FP* x, const FP* y, std::size_t first, std::size_t size,
+              std::size_t sum_index, STEP& step)
+{
+    FP sum;
+    if constexpr (vectorized<FP>)
+    {
+        auto const same = [sum_index](std::size_t) { return sum_index; };
+        vec<FP> const v = step.lanes_add(step.lanes_add(acc[0], acc[1], same), step.lanes_add(acc[2], acc[3], same),
+                                         same);
+        sum = v[0];
+        for (std::size_t l = 1; l < lanes<FP>; ++l) sum = step.add(sum, v[l], sum_index);
+    }
+    else
+        sum = step.add(step.add(acc[0], acc[1], sum_index), step.add(acc[2], acc[3], sum_index), sum_index);
+    for (std::size_t i = first; i < size; ++i) sum = step.multiply_add(sum, x[i], y[i], i);
+    return sum;
+}
+
+// Result of a kernel: the first failure, when failed
+struct failure
+{
+    bool failed = false;
+    std::size_t index = 0;
+    std::string message;
+};
+
+// x.y over size values, the first failure is kept in f with the index of the values, or sum_index when the sum of
+// the accumulators fails
+template<class FP, class POLICY>
+FP dot_values(const FP* x, const FP* y, std::size_t size, std::size_t sum_index, failure& f)
+{
+    checking_step<FP, POLICY> step;
+    accumulator_set<FP> acc{};
+    std::size_t const blocks_end = size - size % block<FP>;
+    for (std::size_t i = 0; i < blocks_end; i += tile_size)
+    {
+        std::size_t const tile_end = std::min(blocks_end, i + tile_size);
+        accumulator_set<FP> start;
+        std::copy(std::begin(acc), std::end(acc), std::begin(start));
+        step.restart();
+        accumulate_blocks<FP>(acc, x, y, i, tile_end, step);
+        if (step.failed() && !f.failed)
+        {
+            // rare path: the tile is replayed from the accumulators it started from
+            replay_step<FP, POLICY> replay;
+            accumulate_blocks<FP>(start, x, y, i, tile_end, replay);
+            if (replay.capture.failed) f = failure{true, replay.index, replay.capture.message};
+        }
+    }
+    step.restart();
+    FP const result = finish_dot<FP>(acc, x, y, blocks_end, size, sum_index, step);
+    if (step.failed() && !f.failed)
+    {
+        replay_step<FP, POLICY> replay;
+        finish_dot<FP>(acc, x, y, blocks_end, size, sum_index, replay);
+        if (replay.capture.failed) f = failure{true, replay.index, replay.capture.message};
+    }
+    return result;
+}
+
+// The elements of the matrix products are accumulated one by one from 0, in the order of k, whatever the blocks
+template<class FP, class STEP>
+FP product_element(const FP* a, const FP* b, std::size_t k, std::size_t ldb, std::size_t index, STEP& step)
+{
+    FP c = 0;
+    for (std::size_t p = 0; p < k; ++p) c = step.multiply_add(c, a[p], b[p * ldb], index);
+    return c;
+}
+
+// C[rows, columns] += A[rows, p0:p1] * B[p0:p1, columns], for ROWS rows and 2 vectors of columns, the row and column
+// strides being lda, ldb and ldc
+template<std::size_t ROWS, class FP, class STEP>
+void multiply_tile(const FP* a, const FP* b, FP* c, std::size_t p0, std::size_t p1, std::size_t lda, std::size_t ldb,
+                   std::size_t ldc, STEP& step)
+{
+    constexpr std::size_t n = lanes<FP>;
+    vec<FP> acc[ROWS][2];
+    for (std::size_t r = 0; r < ROWS; ++r)
+    {
+        acc[r][0] = load(c + r * ldc);
+        acc[r][1] = load(c + r * ldc + n);
+    }
+    for (std::size_t p = p0; p < p1; ++p)
+    {
+        vec<FP> const b0 = load(b + p * ldb);
+        vec<FP> const b1 = load(b + p * ldb + n);
+        for (std::size_t r = 0; r < ROWS; ++r)
+        {
+            vec<FP> const ar = broadcast(a[r * lda + p]);
+            acc[r][0] = step.lanes_multiply_add(acc[r][0], ar, b0, 0);
+            acc[r][1] = step.lanes_multiply_add(acc[r][1], ar, b1, 0);
+        }
+    }
+    for (std::size_t r = 0; r < ROWS; ++r)
+    {
+        store(c + r * ldc, acc[r][0]);
+        store(c + r * ldc + n, acc[r][1]);
+    }
+}
+} // namespace detail
+
+// Checked linear algebra on contiguous arrays of safe_float, the first failure is given to the handler with its index
+// through report_batch_failure(message, index) when it provides it, otherwise appended to the message given to
+// report_failure. The outputs must not overlap the inputs.
+
+// x.y, the index is the one of the values multiplied, size when the sum of the partial sums fails
+template<class SF, class ERROR_HANDLING = typename SF::report_policy>
+SF dot(const SF* x, const SF* y, std::size_t size, ERROR_HANDLING handler = ERROR_HANDLING{})
+{
+    using FP = typename SF::value_type;
+    require_fp_layout<SF>();
+    detail::failure f;
+    FP const result = detail::dot_values<FP, typename SF::check_policy>(
+        reinterpret_cast<const FP*>(x), reinterpret_cast<const FP*>(y), size, size, f);
+    if (f.failed) batch::detail::report_batch_failure(handler, f.message, f.index);
+    return SF(result);
+}
+
+// y[i] = a * x[i] + y[i], y is updated by tiles: the values from the tile failing are left unchanged when the failure
+// reported throws
+template<class SF, class ERROR_HANDLING = typename SF::report_policy>
+void axpy(const SF& a, const SF* x, SF* y, std::size_t size, ERROR_HANDLING handler = ERROR_HANDLING{})
+{
+    using FP = typename SF::value_type;
+    using POLICY = typename SF::check_policy;
+    require_fp_layout<SF>();
+    constexpr std::size_t n = detail::lanes<FP>;
+    const FP* const xs = reinterpret_cast<const FP*>(x);
+    FP* const ys = reinterpret_cast<FP*>(y);
+    FP const av = a.get_stored_value();
+    detail::checking_step<FP, POLICY> step;
+    bool reported = false;
+    FP results[detail::tile_size];
+    for (std::size_t i0 = 0; i0 < size; i0 += detail::tile_size)
+    {
+        std::size_t const i1 = std::min(size, i0 + detail::tile_size);
+        std::size_t const vectors_end = i1 - (i1 - i0) % n;
+        step.restart();
+        for (std::size_t i = i0; i < vectors_end; i += n)
+        {
+            if constexpr (detail::vectorized<FP>)
+                detail::store(results + (i - i0), step.lanes_multiply_add(detail::load(ys + i), detail::broadcast(av),
+                                                                          detail::load(xs + i), i));
+            else
+                results[i - i0] = step.multiply_add(ys[i], av, xs[i], i);
+        }
+        for (std::size_t i = vectors_end; i < i1; ++i) results[i - i0] = step.multiply_add(ys[i], av, xs[i], i);
+        if (step.failed() && !reported)
+        {
+            // rare path: the tile is replayed value by value to find its first failure
+            detail::replay_step<FP, POLICY> replay;
+            for (std::size_t i = i0; i < i1 && !replay.capture.failed; ++i) replay.multiply_add(ys[i], av, xs[i], i);
+            if (replay.capture.failed)
+            {
+                reported = true;
+                batch::detail::report_batch_failure(handler, replay.capture.message, replay.index);
+            }
+        }
+        std::copy(results, results + (i1 - i0), ys + i0);
+    }
+}
+
+// y = A x, A having rows rows of columns values, the index is the one of the y value failing
+template<class SF, class ERROR_HANDLING = typename SF::report_policy>
+void gemv(const SF* a, const SF* x, SF* y, std::size_t rows, std::size_t columns,
+          ERROR_HANDLING handler = ERROR_HANDLING{})
+{
+    using FP = typename SF::value_type;
+    require_fp_layout<SF>();
+    detail::failure first;
+    for (std::size_t i = 0; i < rows; ++i)
+    {
+        detail::failure f;
+        reinterpret_cast<FP*>(y)[i] = detail::dot_values<FP, typename SF::check_policy>(
+            reinterpret_cast<const FP*>(a) + i * columns, reinterpret_cast<const FP*>(x), columns, columns, f);
+        if (f.failed && !first.failed) first = detail::failure{true, i, f.message};
+    }
+    if (first.failed) batch::detail::report_batch_failure(handler, first.message, first.index);
+}
+
+// C = A B, A having m rows of k values and B k rows of n values, the index is the one of the C value failing, row by
+// row. The products are computed by blocks of A and B fitting in the caches, the FE_* flags are tested once per block.
+template<class SF, class ERROR_HANDLING = typename SF::report_policy>
+void gemm(const SF* a, const SF* b, SF* c, std::size_t m, std::size_t k, std::size_t n,
+          ERROR_HANDLING handler = ERROR_HANDLING{})
+{
+    using FP = typename SF::value_type;
+    using POLICY = typename SF::check_policy;
+    require_fp_layout<SF>();
+    const FP* const as = reinterpret_cast<const FP*>(a);
+    const FP* const bs = reinterpret_cast<const FP*>(b);
+    FP* const cs = reinterpret_cast<FP*>(c);
+    // rows of A, columns of B and depth of a block, the B block is kept in the L2 cache and the A rows in L1
+    constexpr std::size_t row_block = 64;
+    constexpr std::size_t column_block = 256;
+    constexpr std::size_t depth_block = 128;
+    constexpr std::size_t tile_columns = 2 * detail::lanes<FP>;
+    std::size_t const vector_columns = detail::vectorized<FP> ? n - n % tile_columns : 0;
+
+    // the first block failing, its elements are replayed once every block is computed
+    bool failed = false;
+    std::size_t failed_rows[2] = {0, 0}, failed_columns[2] = {0, 0};
+    detail::checking_step<FP, POLICY> step;
+
+    std::fill(cs, cs + m * n, FP(0));
+    if constexpr (detail::vectorized<FP>)
+        for (std::size_t j0 = 0; j0 < vector_columns; j0 += column_block)
+        {
+            std::size_t const j1 = std::min(vector_columns, j0 + column_block);
+            for (std::size_t p0 = 0; p0 < k; p0 += depth_block)
+            {
+                std::size_t const p1 = std::min(k, p0 + depth_block);
+                for (std::size_t i0 = 0; i0 < m; i0 += row_block)
+                {
+                    std::size_t const i1 = std::min(m, i0 + row_block);
+                    step.restart();
+                    std::size_t i = i0;
+                    for (; i + 4 <= i1; i += 4)
+                        for (std::size_t j = j0; j < j1; j += tile_columns)
+                            detail::multiply_tile<4>(as + i * k, bs + j, cs + i * n + j, p0, p1, k, n, n, step);
+                    for (; i < i1; ++i)
+                        for (std::size_t j = j0; j < j1; j += tile_columns)
+                            detail::multiply_tile<1>(as + i * k, bs + j, cs + i * n + j, p0, p1, k, n, n, step);
+                    if (step.failed() && !failed)
+                    {
+                        failed = true;
+                        failed_rows[0] = i0;
+                        failed_rows[1] = i1;
+                        failed_columns[0] = j0;
+                        failed_columns[1] = j1;
+                    }
+                }
+            }
+        }
+    // the last columns value by value
+    if (vector_columns < n)
+    {
+        step.restart();
+        for (std::size_t i = 0; i < m; ++i)
+            for (std::size_t j = vector_columns; j < n; ++j)
+                cs[i * n + j] = detail::product_element(as + i * k, bs + j, k, n, i * n + j, step);
+        if (step.failed() && !failed)
+        {
+            failed = true;
+            failed_rows[1] = m;
+            failed_columns[0] = vector_columns;
+            failed_columns[1] = n;
+        }
+    }
+
+    // rare path: the elements of the block failing are computed again one by one to find the first failure
+    if (failed)
+    {
+        detail::replay_step<FP, POLICY> replay;
+        for (std::size_t i = failed_rows[0]; i < failed_rows[1] && !replay.capture.failed; ++i)
+            for (std::size_t j = failed_columns[0]; j < failed_columns[1] && !replay.capture.failed; ++j)
+                detail::product_element(as + i * k, bs + j, k, n, i * n + j, replay);
+        if (replay.capture.failed) batch::detail::report_batch_failure(handler, replay.capture.message, replay.index);
+    }
+}
+
+} // namespace linalg
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_LINALG_HPP
@@ -1,6 +1,10 @@
 #ifndef BOOST_SAFE_FLOAT_LITERALS_HPP
 #define BOOST_SAFE_FLOAT_LITERALS_HPP
 
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
 #include <boost/safe_float.hpp>
 
 
@@ -202,95 +206,242 @@ constexpr RT test_hex()
 }
 
 
-// Validate value and returns it
-template<typename RT, unsigned long long MANTISSA, int POW, bool SIGN, int EXPONENT>
-constexpr RT validate_dec()
-{
-    constexpr RT value =
-        (POW + (SIGN ? EXPONENT : -EXPONENT) < 0 ? MANTISSA / trivial_pow(10.0l, -POW - (SIGN ? EXPONENT : -EXPONENT)) :
-                                                   MANTISSA * trivial_pow(10.0l, POW + (SIGN ? EXPONENT : -EXPONENT)));
-    return value;
-}
-
+/*
+ * Decimal parsing. The digits and the exponent are read from the characters of the literal, then the value
+ * digits * 10^exponent is rounded to nearest even with big integers: the quotient of the numerator digits * 10^exponent
+ * by the denominator 10^-exponent gives the bits of the FP one by one, the remainder the sticky bit.
+ */
 
-// This function parses the exponent past the first character
-template<typename RT, unsigned long long MANTISSA, int POW, bool SIGN, int EXPONENT>
-constexpr RT parse_dec_exponent()
+// Significant digits and decimal exponent of a decimal literal, the value is digits[0..count) * 10^exponent
+template<std::size_t N>
+struct decimal_literal
 {
-    return validate_dec<RT, MANTISSA, POW, SIGN, EXPONENT>();
-}
+    bool valid = true;
+    char digits[N + 1]{};
+    int count = 0;
+    int exponent = 0;
+};
 
-template<typename RT, unsigned long long MANTISSA, int POW, bool SIGN, int EXPONENT, char FIRST, char... REST>
-constexpr RT parse_dec_exponent()
+template<std::size_t N>
+constexpr decimal_literal<N> scan_dec(const char (&str)[N + 1])
 {
-    static_assert(isdigit(FIRST), DEC_PARSE_ERROR);
-    return parse_dec_exponent<RT, MANTISSA, POW, SIGN, EXPONENT * 10 + decvalue(FIRST), REST...>();
+    decimal_literal<N> lit;
+    std::size_t i = 0;
+    bool period = false, any_digit = false;
+    for (; isdigit(str[i]) or (str[i] == '.' and !period); ++i)
+    {
+        if (str[i] == '.')
+        {
+            period = true;
+            continue;
+        }
+        any_digit = true;
+        // leading zeros aren't significant
+        if (lit.count > 0 or str[i] != '0') lit.digits[lit.count++] = str[i];
+        if (period) --lit.exponent;
+    }
+    lit.valid = any_digit;
+    if (str[i] == 'e' or str[i] == 'E')
+    {
+        ++i;
+        bool negative = false;
+        if (str[i] == '+' or str[i] == '-') negative = str[i++] == '-';
+        int exponent = 0;
+        lit.valid = lit.valid and isdigit(str[i]);
+        // the exponents beyond any FP range only have to stay beyond it
+        for (; isdigit(str[i]); ++i)
+            if (exponent < 100000) exponent = exponent * 10 + decvalue(str[i]);
+        lit.exponent += negative ? -exponent : exponent;
+    }
+    lit.valid = lit.valid and str[i] == '\0';
+    // trailing zeros aren't significant either
+    while (lit.count > 0 and lit.digits[lit.count - 1] == '0')
+    {
+        --lit.count;
+        ++lit.exponent;
+    }
+    return lit;
 }
+// Unsigned integer of LIMBS 32 bits limbs, with the operations rounding a decimal literal needs
+template<std::size_t LIMBS>
+struct big_unsigned
+{
+    std::uint32_t limbs[LIMBS]{};
+    // the limbs above used are 0
+    std::size_t used = 0;
+
+    constexpr void multiply_add(std::uint32_t factor, std::uint32_t addend)
+    {
+        std::uint64_t carry = addend;
+        for (std::size_t i = 0; i < used; ++i)
+        {
+            std::uint64_t const v = std::uint64_t(limbs[i]) * factor + carry;
+            limbs[i] = std::uint32_t(v);
+            carry = v >> 32;
+        }
+        if (carry != 0) limbs[used++] = std::uint32_t(carry);
+        normalize();
+    }
 
+    constexpr void multiply_pow10(int n)
+    {
+        for (; n >= 9; n -= 9) multiply_add(1000000000u, 0);
+        std::uint32_t factor = 1;
+        for (; n > 0; --n) factor *= 10;
+        multiply_add(factor, 0);
+    }
 
-// This function parses the first character of the exponent
-template<typename RT, unsigned long long MANTISSA, int POW>
-constexpr RT parse_dec_exponent_sign()
-{
-    static_assert(always_false<RT>::value, DEC_PARSE_ERROR);
-    return RT{};
-}
+    constexpr void shift_left(int n)
+    {
+        std::size_t const whole = std::size_t(n / 32);
+        int const part = n % 32;
+        std::size_t const shifted = used == 0 ? 0 : used + whole + (part != 0 ? 1 : 0);
+        // from the top, the limbs read are never below the ones written
+        for (std::size_t i = shifted; i-- > 0;)
+        {
+            std::uint64_t bits = 0;
+            if (i >= whole and i - whole < used) bits |= std::uint64_t(limbs[i - whole]) << part;
+            if (part != 0 and i >= whole + 1 and i - whole - 1 < used) bits |= limbs[i - whole - 1] >> (32 - part);
+            limbs[i] = std::uint32_t(bits);
+        }
+        used = shifted;
+        normalize();
+    }
 
-template<typename RT, unsigned long long MANTISSA, int POW, char FIRST, char... REST>
-constexpr RT parse_dec_exponent_sign()
-{
-    static_assert(isdigit(FIRST) or ((FIRST == '+' or FIRST == '-') and sizeof...(REST) > 0), DEC_PARSE_ERROR);
-    if constexpr (isdigit(FIRST))
-        return parse_dec_exponent<RT, MANTISSA, POW, true, decvalue(FIRST), REST...>();
-    else if constexpr (FIRST == '+')
-        return parse_dec_exponent<RT, MANTISSA, POW, true, 0, REST...>();
-    else
-        return parse_dec_exponent<RT, MANTISSA, POW, false, 0, REST...>();
-}
+    constexpr void subtract(const big_unsigned& other)
+    {
+        std::int64_t borrow = 0;
+        for (std::size_t i = 0; i < used; ++i)
+        {
+            std::int64_t v = std::int64_t(limbs[i]) - (i < other.used ? other.limbs[i] : 0) - borrow;
+            borrow = v < 0;
+            limbs[i] = std::uint32_t(v + (borrow << 32));
+        }
+        normalize();
+    }
+
+    constexpr bool less(const big_unsigned& other) const
+    {
+        if (used != other.used) return used < other.used;
+        for (std::size_t i = used; i-- > 0;)
+            if (limbs[i] != other.limbs[i]) return limbs[i] < other.limbs[i];
+        return false;
+    }
 
+    constexpr int bit_length() const
+    {
+        int bits = used == 0 ? 0 : int(used - 1) * 32;
+        for (std::uint32_t top = used == 0 ? 0 : limbs[used - 1]; top != 0; top >>= 1) ++bits;
+        return bits;
+    }
 
-// This function parses the characters that are after the period
-template<typename RT, unsigned long long MANTISSA, int POW>
-constexpr RT parse_dec_post_period()
+    constexpr bool is_zero() const { return used == 0; }
+
+    constexpr void normalize()
+    {
+        while (used > 0 and limbs[used - 1] == 0) --used;
+    }
+};
+
+// Value of a literal in the FP RT, and whether it is exactly the literal
+template<typename RT>
+struct rounded_literal
 {
-    return validate_dec<RT, MANTISSA, POW, true, 0>();
-}
+    RT value;
+    bool exact;
+};
 
-template<typename RT, unsigned long long MANTISSA, int POW, char FIRST, char... REST>
-constexpr RT parse_dec_post_period()
+// The literals whose leading digit is above the largest FP or far below the smallest one aren't computed
+template<typename RT, std::size_t N>
+constexpr bool overflows(const decimal_literal<N>& lit)
 {
-    static_assert(isdigit(FIRST) or FIRST == 'e' or FIRST == 'E', DEC_PARSE_ERROR);
-    if constexpr (isdigit(FIRST))
-        return parse_dec_post_period<RT, MANTISSA * 10 + decvalue(FIRST), POW - 1, REST...>();
-    else
-        return parse_dec_exponent_sign<RT, MANTISSA, POW, REST...>();
+    return lit.count > 0 and lit.count + lit.exponent - 1 > std::numeric_limits<RT>::max_exponent10;
 }
 
+template<typename RT, std::size_t N>
+constexpr bool vanishes(const decimal_literal<N>& lit)
+{
+    using limits = std::numeric_limits<RT>;
+    return lit.count > 0 and lit.count + lit.exponent < limits::min_exponent10 - limits::max_digits10 - 2;
+}
 
-// This character parses the first characters before the period
-template<typename RT, unsigned long long MANTISSA>
-constexpr RT parse_dec_pre_period()
+// Limbs holding the numerator and the denominator once aligned, with the bits of the FP
+template<typename RT, std::size_t N>
+constexpr std::size_t limbs_needed(const decimal_literal<N>& lit)
 {
-    return validate_dec<RT, MANTISSA, 0, true, 0>();
+    if (overflows<RT>(lit) or vanishes<RT>(lit)) return 1;
+    int const decimal_digits = lit.count + (lit.exponent < 0 ? -lit.exponent : lit.exponent);
+    // log2(10) < 3.322
+    return std::size_t((decimal_digits * 3322 / 1000 + std::numeric_limits<RT>::digits + 8) / 32 + 2);
 }
 
-template<typename RT, unsigned long long MANTISSA, char FIRST, char... REST>
-constexpr RT parse_dec_pre_period()
+template<typename RT, std::size_t LIMBS, std::size_t N>
+constexpr rounded_literal<RT> round_dec(const decimal_literal<N>& lit)
 {
-    static_assert(isdigit(FIRST) or FIRST == '.' or FIRST == 'e' or FIRST == 'E', DEC_PARSE_ERROR);
-    if constexpr (isdigit(FIRST))
-        return parse_dec_pre_period<RT, MANTISSA * 10 + decvalue(FIRST), REST...>();
-    else if constexpr (FIRST == '.')
-        return parse_dec_post_period<RT, MANTISSA, 0, REST...>();
+    using limits = std::numeric_limits<RT>;
+    if (lit.count == 0) return {RT(0), true};
+    if (overflows<RT>(lit)) return {limits::infinity(), false};
+    if (vanishes<RT>(lit)) return {RT(0), false};
+
+    big_unsigned<LIMBS> num, den;
+    for (int i = 0; i < lit.count; ++i) num.multiply_add(10, std::uint32_t(decvalue(lit.digits[i])));
+    den.multiply_add(1, 1);
+    if (lit.exponent >= 0)
+        num.multiply_pow10(lit.exponent);
     else
-        return parse_dec_exponent_sign<RT, MANTISSA, 0, REST...>();
-}
+        den.multiply_pow10(-lit.exponent);
 
+    // num / den in [1, 2), the value is num / den * 2^exponent
+    int exponent = num.bit_length() - den.bit_length();
+    if (exponent >= 0)
+        den.shift_left(exponent);
+    else
+        num.shift_left(-exponent);
+    if (num.less(den))
+    {
+        num.shift_left(1);
+        --exponent;
+    }
+    if (exponent > limits::max_exponent - 1) return {limits::infinity(), false};
+
+    // bits of the mantissa, less below the normal range, none below half the smallest subnormal
+    int const kept = exponent >= limits::min_exponent - 1 ? limits::digits
+                                                          : limits::digits - (limits::min_exponent - 1 - exponent);
+    RT mantissa = 0, carried = 1;
+    bool odd = false;
+    for (int i = 0; i < kept; ++i)
+    {
+        odd = !num.less(den);
+        if (odd) num.subtract(den);
+        mantissa = mantissa * 2 + (odd ? 1 : 0);
+        carried *= 2;
+        num.shift_left(1);
+    }
+    // the next bit rounds, the remainder is sticky
+    bool round = false;
+    if (kept >= 0)
+    {
+        round = !num.less(den);
+        if (round) num.subtract(den);
+    }
+    bool const sticky = kept < 0 or !num.is_zero();
+    if (round and (sticky or odd)) mantissa += 1;
+    if (mantissa == carried and exponent == limits::max_exponent - 1) return {limits::infinity(), false};
+
+    // exact scaling by powers of 2, the result is representable
+    RT value = mantissa;
+    for (int scale = exponent - kept + 1; scale > 0; --scale) value *= 2;
+    for (int scale = exponent - kept + 1; scale < 0; ++scale) value /= 2;
+    return {value, !round and !sticky};
+}
 
 template<typename RT, char... STR>
-constexpr RT test_dec()
+constexpr rounded_literal<RT> test_dec()
 {
-    return parse_dec_pre_period<RT, 0, STR...>();
+    constexpr char str[] = {STR..., '\0'};
+    constexpr decimal_literal<sizeof...(STR)> lit = scan_dec<sizeof...(STR)>(str);
+    static_assert(lit.valid, DEC_PARSE_ERROR);
+    return round_dec<RT, limbs_needed<RT>(lit)>(lit);
 }
 
 // Don't pollute global namespace
@@ -299,25 +450,76 @@ constexpr RT test_dec()
 #undef VALUE_ERROR
 
 
+// The value of the literal in RT, correctly rounded
 template<typename RT, char... STR>
-constexpr RT parse_float_literal()
+constexpr rounded_literal<RT> parse_float_literal()
 {
     if constexpr (has_hex_prefix<STR...>())
-        return test_hex<RT, STR...>();
+    {
+        // a power of 2, exact in long double, and in RT when converting it back gives the same value
+        constexpr long double value = test_hex<long double, STR...>();
+        return {static_cast<RT>(value), value != 0 and static_cast<long double>(static_cast<RT>(value)) == value};
+    }
     else
         return test_dec<RT, STR...>();
 }
+
+// A safe_float checking the rounding of any operation doesn't accept literals that are rounded
+template<typename SF>
+constexpr bool checks_inexact() noexcept
+{
+    using category = policy::detected_category<typename SF::value_type, typename SF::check_policy,
+                                               policy::failure_category::inexact>;
+    return category::addition or category::subtraction or category::multiplication or category::division;
+}
 } // namespace detail
 
 
+// The literal STR... as the safe_float SF. The decimal literals are correctly rounded at compile time, they and the
+// hexadecimal ones out of the range of FP are rejected when rounded if the check policy of SF checks the inexact
+// operations.
+template<typename SF, char... STR>
+constexpr SF make_literal()
+{
+    using FP = typename SF::value_type;
+    constexpr detail::rounded_literal<FP> literal = detail::parse_float_literal<FP, STR...>();
+    static_assert(literal.value != std::numeric_limits<FP>::infinity(),
+                  "Floating point number literal out of the range of the safe_float");
+    static_assert(literal.exact or !detail::checks_inexact<SF>(),
+                  "Floating point number literal not representable by a safe_float checking the inexact operations");
+    return SF(literal.value);
+}
+
 template<char... STR>
-boost::safe_float::safe_float<double> operator""_sd()
+constexpr boost::safe_float::safe_float<float> operator""_sf()
 {
-    return boost::safe_float::safe_float<double>(detail::parse_float_literal<double, STR...>());
+    return make_literal<boost::safe_float::safe_float<float>, STR...>();
+}
+
+template<char... STR>
+constexpr boost::safe_float::safe_float<double> operator""_sd()
+{
+    return make_literal<boost::safe_float::safe_float<double>, STR...>();
+}
+
+template<char... STR>
+constexpr boost::safe_float::safe_float<long double> operator""_sld()
+{
+    return make_literal<boost::safe_float::safe_float<long double>, STR...>();
 }
 
 } // namespace literals
 } // namespace safe_float
 } // namespace boost
 
-#endif // BOOST_SAFE_FLOAT_LITERALS_HPP
\ No newline at end of file
+// Defines the literal operator SUFFIX for the safe_float SAFE_FLOAT, an alias when its template arguments have commas:
+//     using exact_double = safe_float<double, policy::check_inexact_rounding_eft>;
+//     BOOST_SAFE_FLOAT_LITERAL(_exact, exact_double)
+#define BOOST_SAFE_FLOAT_LITERAL(SUFFIX, SAFE_FLOAT)                                      \
+    template<char... STR>                                                                 \
+    constexpr SAFE_FLOAT operator"" SUFFIX()                                              \
+    {                                                                                     \
+        return ::boost::safe_float::literals::make_literal<SAFE_FLOAT, STR...>();         \
+    }
+
+#endif // BOOST_SAFE_FLOAT_LITERALS_HPP
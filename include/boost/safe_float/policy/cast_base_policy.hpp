@@ -23,7 +23,7 @@ struct cast_policy
     static constexpr bool can_explicitly_cast_from = false;
 
     template<typename T>
-    static void cast_from(FP& target, T source)
+    static constexpr void cast_from(FP& target, T source)
     {
         target = source;
     }
@@ -35,7 +35,7 @@ struct cast_policy
     static constexpr bool can_explicitly_cast_to = false;
 
     template<typename T>
-    static T cast_to(FP source)
+    static constexpr T cast_to(FP source)
     {
         return T(source);
     }
@@ -62,23 +62,23 @@ template<typename FP, typename CAST_POLICY>
 struct cast_helper
 {
     template<typename T, std::enable_if_t<CAST_POLICY::template can_cast_from<T>, int> = 0>
-    static void construct_implicitly(FP& target, T source)
+    static constexpr void construct_implicitly(FP& target, T source)
     {
         CAST_POLICY::template cast_from<T>(target, source);
     }
     template<typename T, std::enable_if_t<CAST_POLICY::template can_explicitly_cast_from<T>, int> = 0>
-    static void construct_explicitly(FP& target, T source)
+    static constexpr void construct_explicitly(FP& target, T source)
     {
         CAST_POLICY::template cast_from<T>(target, source);
     }
 
     template<typename T, std::enable_if_t<CAST_POLICY::template can_cast_to<T>, int> = 0>
-    static T convert_implicitly(FP source)
+    static constexpr T convert_implicitly(FP source)
     {
         return CAST_POLICY::template cast_to<T>(source);
     }
     template<typename T, std::enable_if_t<CAST_POLICY::template can_explicitly_cast_to<T>, int> = 0>
-    static T convert_explicitly(FP source)
+    static constexpr T convert_explicitly(FP source)
     {
         return CAST_POLICY::template cast_to<T>(source);
     }
@@ -24,7 +24,7 @@ struct none_impl
     static constexpr bool can_explicitly_cast_from = false;
     
     template<typename T>
-    static void cast_from(typename SF::value_type& target, T source)
+    static constexpr void cast_from(typename SF::value_type& target, T source)
     {
         target = source;
     }
@@ -52,7 +52,7 @@ struct same_impl
         is_explicit && std::is_same_v<typename SF::value_type, T>;
 
     template<typename T>
-    static void cast_from(typename SF::value_type& target, T source)
+    static constexpr void cast_from(typename SF::value_type& target, T source)
     {
         target = source;
     }
@@ -81,7 +81,7 @@ struct more_precise_impl
         is_explicit && std::is_floating_point_v<T> && std::numeric_limits<T>::digits >= std::numeric_limits<typename SF::value_type>::digits;
 
     template<typename T>
-    static void cast_from(typename SF::value_type& target, T source)
+    static constexpr void cast_from(typename SF::value_type& target, T source)
     {
         target = source;
     }
@@ -110,7 +110,7 @@ struct less_precise_impl
         is_explicit && std::is_floating_point_v<T>&& std::numeric_limits<T>::digits <= std::numeric_limits<typename SF::value_type>::digits;
 
     template<typename T>
-    static void cast_from(typename SF::value_type& target, T source)
+    static constexpr void cast_from(typename SF::value_type& target, T source)
     {
         target = source;
     }
@@ -137,7 +137,7 @@ struct all_impl
     static constexpr bool can_explicitly_cast_from = is_explicit && std::is_floating_point_v<T>;
 
     template<typename T>
-    static void cast_from(typename SF::value_type& target, T source)
+    static constexpr void cast_from(typename SF::value_type& target, T source)
     {
         target = source;
     }
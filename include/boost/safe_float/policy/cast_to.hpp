@@ -26,7 +26,7 @@ namespace policy
             static constexpr bool can_explicitly_cast_to = false;
 
             template<typename U, std::enable_if_t<std::is_same_v<T, U>, int> = 0>
-            static T cast_to(typename SF::value_type source)
+            static constexpr T cast_to(typename SF::value_type source)
             {
                 return T(source);
             }
@@ -51,7 +51,7 @@ namespace policy
             static constexpr bool can_explicitly_cast_to = std::is_same_v<T, U>;
 
             template<typename U, std::enable_if_t<std::is_same_v<T, U>, int> = 0>
-            static T cast_to(typename SF::value_type source)
+            static constexpr T cast_to(typename SF::value_type source)
             {
                 return T(source);
             }
@@ -29,7 +29,7 @@ struct none_impl
     static constexpr bool can_explicitly_cast_to = false;
 
     template<typename T>
-    static T cast_to(typename SF::value_type source)
+    static constexpr T cast_to(typename SF::value_type source)
     {
         return T(source);
     }
@@ -56,7 +56,7 @@ struct same_impl
     static constexpr bool can_explicitly_cast_to = is_explicit&& std::is_same_v<typename SF::value_type, T>;
 
     template<typename T>
-    static T cast_to(typename SF::value_type source)
+    static constexpr T cast_to(typename SF::value_type source)
     {
         return T(source);
     }
@@ -85,7 +85,7 @@ struct more_precise_impl
                                                                                                 >= std::numeric_limits<typename SF::value_type>::digits;
 
     template<typename T>
-    static T cast_to(typename SF::value_type source)
+    static constexpr T cast_to(typename SF::value_type source)
     {
         return T(source);
     }
@@ -114,7 +114,7 @@ struct less_precise_impl
                                                                                                 <= std::numeric_limits<typename SF::value_type>::digits;
 
     template<typename T>
-    static T cast_to(typename SF::value_type source)
+    static constexpr T cast_to(typename SF::value_type source)
     {
         return T(source);
     }
@@ -141,7 +141,7 @@ struct all_impl
     static constexpr bool can_explicitly_cast_to = is_explicit && std::is_floating_point_v<T>;
     
     template<typename T>
-    static T cast_to(typename SF::value_type source)
+    static constexpr T cast_to(typename SF::value_type source)
     {
         return T(source);
     }
@@ -0,0 +1,33 @@
+#ifndef BOOST_SAFE_FLOAT_POLICY_CHECK_ADDITION_INEXACT_EFT_HPP
+#define BOOST_SAFE_FLOAT_POLICY_CHECK_ADDITION_INEXACT_EFT_HPP
+
+#include <boost/safe_float/policy/check_base_policy.hpp>
+#include <boost/safe_float/policy/error_free_transformation.hpp>
+
+namespace boost {
+namespace safe_float{
+namespace policy{
+
+/**
+ * Checks the addition is exact with an error-free transformation, in both the fenv and the software builds.
+ * Unlike check_addition_inexact, no FE_* flag is used and the check can be inlined and vectorized.
+ */
+template<class FP>
+class check_addition_inexact_eft : public check_policy<FP> {
+public:
+    static constexpr failure_category addition_failure_category = failure_category::inexact;
+
+    constexpr bool post_addition_check(const FP& lhs, const FP& rhs, const FP& result){
+        return eft::addition_is_exact<FP>(lhs, rhs, result);
+    }
+
+    std::string addition_failure_message(){
+        return std::string("Non reversible addition applied");
+    }
+
+};
+
+}
+}
+}
+#endif // BOOST_SAFE_FLOAT_POLICY_CHECK_ADDITION_INEXACT_EFT_HPP
@@ -2,6 +2,8 @@
 #define BOOST_SAFE_FLOAT_POLICY_CHECK_ADDITION_UNDERFLOW_HPP
 
 #include <boost/safe_float/policy/check_base_policy.hpp>
+#include <boost/safe_float/policy/classify.hpp>
+#include <boost/safe_float/policy/fenv_flags.hpp>
 
 #ifdef FENV_AVAILABLE
 #pragma STDC FENV_ACCESS ON
@@ -15,20 +17,22 @@ namespace policy{
 template<class FP>
 class check_addition_underflow : public check_policy<FP> {
 public:
-    bool pre_addition_check(const FP& lhs, const FP& rhs){
-#ifndef FENV_AVAILABLE
-        return true;
-#else
-        return ! std::feclearexcept(FE_UNDERFLOW);
+    static constexpr failure_category addition_failure_category = failure_category::underflow;
+#ifdef FENV_AVAILABLE
+    static constexpr int addition_fenv_flags = FE_UNDERFLOW;
+#endif
+    constexpr bool pre_addition_check(const FP& lhs, const FP& rhs){
+#ifdef FENV_AVAILABLE
+        if (fenv_flags::in_use<FP>()) return fenv_flags::clear<FP>(FE_UNDERFLOW);
 #endif
+        return true;
     }
 
-    bool post_addition_check(const FP& rhs){
-#ifndef FENV_AVAILABLE
-        return std::fpclassify( rhs ) != FP_SUBNORMAL;
-#else
-        return ! std::fetestexcept(FE_UNDERFLOW);
+    constexpr bool post_addition_check(const FP& lhs, const FP& rhs, const FP& result){
+#ifdef FENV_AVAILABLE
+        if (fenv_flags::in_use<FP>()) return ! fenv_flags::test<FP>(FE_UNDERFLOW);
 #endif
+        return !classify::is_subnormal(result);
     }
 
     std::string addition_failure_message(){
@@ -4,6 +4,8 @@
 #include <string>
 #include <cmath>
 
+#include <boost/safe_float/policy/failure.hpp>
+
 namespace boost {
 namespace safe_float{
 namespace policy{
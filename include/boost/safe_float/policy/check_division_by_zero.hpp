@@ -2,6 +2,7 @@
 #define BOOST_SAFE_FLOAT_POLICY_CHECK_DIVISION_BY_ZERO_HPP
 
 #include <boost/safe_float/policy/check_base_policy.hpp>
+#include <boost/safe_float/policy/fenv_flags.hpp>
 
 #ifdef FENV_AVAILABLE
 #pragma STDC FENV_ACCESS ON
@@ -15,20 +16,22 @@ namespace policy{
 template<class FP>
 class check_division_by_zero : public check_policy<FP> {
 public:
-    bool pre_division_check(const FP& lhs, const FP& rhs){
-#ifndef FENV_AVAILABLE
-        return (rhs!=0);
-#else
-        return ! std::feclearexcept(FE_DIVBYZERO);
+    static constexpr failure_category division_failure_category = failure_category::division_by_zero;
+#ifdef FENV_AVAILABLE
+    static constexpr int division_fenv_flags = FE_DIVBYZERO;
+#endif
+    constexpr bool pre_division_check(const FP& lhs, const FP& rhs){
+#ifdef FENV_AVAILABLE
+        if (fenv_flags::in_use<FP>()) return fenv_flags::clear<FP>(FE_DIVBYZERO);
 #endif
+        return (rhs!=0);
     }
 
-    bool post_division_check(const FP& rhs){
-#ifndef FENV_AVAILABLE
-        return true;
-#else
-        return ! std::fetestexcept(FE_DIVBYZERO);
+    constexpr bool post_division_check(const FP& lhs, const FP& rhs, const FP& result){
+#ifdef FENV_AVAILABLE
+        if (fenv_flags::in_use<FP>()) return ! fenv_flags::test<FP>(FE_DIVBYZERO);
 #endif
+        return true;
     }
 
     std::string division_failure_message(){
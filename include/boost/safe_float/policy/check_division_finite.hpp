@@ -0,0 +1,37 @@
+#ifndef BOOST_SAFE_FLOAT_POLICY_CHECK_DIVISION_FINITE_HPP
+#define BOOST_SAFE_FLOAT_POLICY_CHECK_DIVISION_FINITE_HPP
+
+#include <boost/safe_float/policy/check_base_policy.hpp>
+#include <boost/safe_float/policy/classify.hpp>
+#include <boost/safe_float/policy/finite_diagnosis.hpp>
+
+namespace boost {
+namespace safe_float{
+namespace policy{
+
+/**
+ * Checks the result of the division is finite. lhs / inf is finite, the divisor is tested as well.
+ * The cause of a failure, reported as the category, is only looked for when the check failed.
+ * No FE_* flag is used, in both the fenv and the software builds.
+ */
+template<class FP>
+class check_division_finite : public check_policy<FP> {
+public:
+    constexpr bool post_division_check(const FP& lhs, const FP& rhs, const FP& result){
+        return classify::is_finite(result) & classify::is_finite(rhs);
+    }
+
+    // Cause of a failure of the check, diagnosed from the operands and the result once it failed
+    failure_category division_failed_category(const FP& lhs, const FP& rhs, const FP& result) const noexcept {
+        return diagnose_non_finite<FP>(operation_kind::division, lhs, rhs, result);
+    }
+
+    // The failures are reported with the message of the category diagnosed, this one is the message without cause
+    std::string division_failure_message(){ return std::string("Non finite result on division operation"); }
+
+};
+
+}
+}
+}
+#endif // BOOST_SAFE_FLOAT_POLICY_CHECK_DIVISION_FINITE_HPP
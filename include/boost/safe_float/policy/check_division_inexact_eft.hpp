@@ -0,0 +1,33 @@
+#ifndef BOOST_SAFE_FLOAT_POLICY_CHECK_DIVISION_INEXACT_EFT_HPP
+#define BOOST_SAFE_FLOAT_POLICY_CHECK_DIVISION_INEXACT_EFT_HPP
+
+#include <boost/safe_float/policy/check_base_policy.hpp>
+#include <boost/safe_float/policy/error_free_transformation.hpp>
+
+namespace boost {
+namespace safe_float{
+namespace policy{
+
+/**
+ * Checks the division is exact with an error-free transformation, in both the fenv and the software builds.
+ * Unlike check_division_inexact, no FE_* flag is used and the check can be inlined and vectorized.
+ */
+template<class FP>
+class check_division_inexact_eft : public check_policy<FP> {
+public:
+    static constexpr failure_category division_failure_category = failure_category::inexact;
+
+    constexpr bool post_division_check(const FP& lhs, const FP& rhs, const FP& result){
+        return eft::division_is_exact<FP>(lhs, rhs, result);
+    }
+
+    std::string division_failure_message(){
+        return std::string("Non reversible division applied");
+    }
+
+};
+
+}
+}
+}
+#endif // BOOST_SAFE_FLOAT_POLICY_CHECK_DIVISION_INEXACT_EFT_HPP
@@ -2,6 +2,8 @@
 #define BOOST_SAFE_FLOAT_POLICY_CHECK_DIVISION_OVERFLOW_HPP
 
 #include <boost/safe_float/policy/check_base_policy.hpp>
+#include <boost/safe_float/policy/classify.hpp>
+#include <boost/safe_float/policy/fenv_flags.hpp>
 
 #ifdef FENV_AVAILABLE
 #pragma STDC FENV_ACCESS ON
@@ -14,22 +16,22 @@ namespace policy{
 
 template<class FP>
 class check_division_overflow : public check_policy<FP> {
-    bool precond=true;
 public:
-    bool pre_division_check(const FP& lhs, const FP& rhs){
-#ifndef FENV_AVAILABLE
-        precond = std::isinf(lhs) || std::isinf(rhs);
-        return true;
-#else
-        return ! std::feclearexcept(FE_OVERFLOW);
+    static constexpr failure_category division_failure_category = failure_category::overflow;
+#ifdef FENV_AVAILABLE
+    static constexpr int division_fenv_flags = FE_OVERFLOW;
+#endif
+    constexpr bool pre_division_check(const FP& lhs, const FP& rhs){
+#ifdef FENV_AVAILABLE
+        if (fenv_flags::in_use<FP>()) return fenv_flags::clear<FP>(FE_OVERFLOW);
 #endif
+        return true;
     }
-    bool post_division_check(const FP& rhs){
-#ifndef FENV_AVAILABLE
-        return precond || ! std::isinf(rhs);
-#else
-        return ! std::fetestexcept(FE_OVERFLOW);
+    constexpr bool post_division_check(const FP& lhs, const FP& rhs, const FP& result){
+#ifdef FENV_AVAILABLE
+        if (fenv_flags::in_use<FP>()) return ! fenv_flags::test<FP>(FE_OVERFLOW);
 #endif
+        return classify::is_inf(lhs) || classify::is_inf(rhs) || ! classify::is_inf(result);
     }
     std::string division_failure_message(){
         return std::string("Overflow to infinite on division operation");
@@ -2,6 +2,8 @@
 #define BOOST_SAFE_FLOAT_POLICY_CHECK_DIVISION_UNDERFLOW_HPP
 
 #include <boost/safe_float/policy/check_base_policy.hpp>
+#include <boost/safe_float/policy/classify.hpp>
+#include <boost/safe_float/policy/fenv_flags.hpp>
 
 #ifdef FENV_AVAILABLE
 #pragma STDC FENV_ACCESS ON
@@ -14,26 +16,24 @@ namespace policy{
 
 template<class FP>
 class check_division_underflow : public check_policy<FP> {
-#ifndef FENV_AVAILABLE
-    bool expect_zero;
-#endif
 public:
-    bool pre_division_check(const FP& lhs, const FP& rhs){
-#ifndef FENV_AVAILABLE
-        expect_zero = (lhs==0);
-        return true;
-#else
-        return ! std::feclearexcept(FE_UNDERFLOW);
+    static constexpr failure_category division_failure_category = failure_category::underflow;
+#ifdef FENV_AVAILABLE
+    static constexpr int division_fenv_flags = FE_UNDERFLOW;
 #endif
+    constexpr bool pre_division_check(const FP& lhs, const FP& rhs){
+#ifdef FENV_AVAILABLE
+        if (fenv_flags::in_use<FP>()) return fenv_flags::clear<FP>(FE_UNDERFLOW);
+#endif
+        return true;
     }
 
-    bool post_division_check(const FP& rhs){
-#ifndef FENV_AVAILABLE
-        return (std::fpclassify( rhs ) != FP_SUBNORMAL)
-                && (rhs != 0 || expect_zero);
-#else
-        return ! std::fetestexcept(FE_UNDERFLOW);
+    constexpr bool post_division_check(const FP& lhs, const FP& rhs, const FP& result){
+#ifdef FENV_AVAILABLE
+        if (fenv_flags::in_use<FP>()) return ! fenv_flags::test<FP>(FE_UNDERFLOW);
 #endif
+        return !classify::is_subnormal(result)
+                && (!classify::is_zero(result) || classify::is_zero(lhs));
     }
 
     std::string division_failure_message(){
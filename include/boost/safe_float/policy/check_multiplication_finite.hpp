@@ -0,0 +1,37 @@
+#ifndef BOOST_SAFE_FLOAT_POLICY_CHECK_MULTIPLICATION_FINITE_HPP
+#define BOOST_SAFE_FLOAT_POLICY_CHECK_MULTIPLICATION_FINITE_HPP
+
+#include <boost/safe_float/policy/check_base_policy.hpp>
+#include <boost/safe_float/policy/classify.hpp>
+#include <boost/safe_float/policy/finite_diagnosis.hpp>
+
+namespace boost {
+namespace safe_float{
+namespace policy{
+
+/**
+ * Checks the result of the multiplication is finite. A non finite operand gives a non finite result, only the result is
+ * tested. The cause of a failure, reported as the category, is only looked for when the check failed.
+ * No FE_* flag is used, in both the fenv and the software builds.
+ */
+template<class FP>
+class check_multiplication_finite : public check_policy<FP> {
+public:
+    constexpr bool post_multiplication_check(const FP& lhs, const FP& rhs, const FP& result){
+        return classify::is_finite(result);
+    }
+
+    // Cause of a failure of the check, diagnosed from the operands and the result once it failed
+    failure_category multiplication_failed_category(const FP& lhs, const FP& rhs, const FP& result) const noexcept {
+        return diagnose_non_finite<FP>(operation_kind::multiplication, lhs, rhs, result);
+    }
+
+    // The failures are reported with the message of the category diagnosed, this one is the message without cause
+    std::string multiplication_failure_message(){ return std::string("Non finite result on multiplication operation"); }
+
+};
+
+}
+}
+}
+#endif // BOOST_SAFE_FLOAT_POLICY_CHECK_MULTIPLICATION_FINITE_HPP
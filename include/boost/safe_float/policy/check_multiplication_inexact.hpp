@@ -2,6 +2,8 @@
 #define BOOST_SAFE_FLOAT_POLICY_CHECK_MULTIPLICATION_INEXACT_HPP
 
 #include <boost/safe_float/policy/check_base_policy.hpp>
+#include <boost/safe_float/policy/classify.hpp>
+#include <boost/safe_float/policy/fenv_flags.hpp>
 
 #ifdef FENV_AVAILABLE
 #pragma STDC FENV_ACCESS ON
@@ -14,27 +16,23 @@ namespace policy{
 
 template<class FP>
 class check_multiplication_inexact : public check_policy<FP> {
-#ifndef FENV_AVAILABLE
-    FP prev_l=0;
-    FP prev_r=0;
-#endif
 public:
-    bool pre_multiplication_check(const FP& lhs, const FP& rhs){
-#ifndef FENV_AVAILABLE
-        prev_l = lhs;
-        prev_r = rhs;
-        return true;
-#else
-        return ! std::feclearexcept(FE_INEXACT);
+    static constexpr failure_category multiplication_failure_category = failure_category::inexact;
+#ifdef FENV_AVAILABLE
+    static constexpr int multiplication_fenv_flags = FE_INEXACT;
 #endif
+    constexpr bool pre_multiplication_check(const FP& lhs, const FP& rhs){
+#ifdef FENV_AVAILABLE
+        if (fenv_flags::in_use<FP>()) return fenv_flags::clear<FP>(FE_INEXACT);
+#endif
+        return true;
     }
 
-    bool post_multiplication_check(const FP& rhs){
-#ifndef FENV_AVAILABLE
-        return ((rhs / prev_r) == prev_l) && ((rhs /  prev_r) == prev_l); //this check is not completely safe, need to do some math to get a proper implementation...
-#else
-        return ! std::fetestexcept(FE_INEXACT);
+    constexpr bool post_multiplication_check(const FP& lhs, const FP& rhs, const FP& result){
+#ifdef FENV_AVAILABLE
+        if (fenv_flags::in_use<FP>()) return ! fenv_flags::test<FP>(FE_INEXACT);
 #endif
+        return classify::is_nan(result) || ((result / rhs) == lhs); //this check is not completely safe, need to do some math to get a proper implementation...
     }
 
     std::string multiplication_failure_message(){
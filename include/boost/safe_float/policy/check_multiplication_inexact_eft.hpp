@@ -0,0 +1,33 @@
+#ifndef BOOST_SAFE_FLOAT_POLICY_CHECK_MULTIPLICATION_INEXACT_EFT_HPP
+#define BOOST_SAFE_FLOAT_POLICY_CHECK_MULTIPLICATION_INEXACT_EFT_HPP
+
+#include <boost/safe_float/policy/check_base_policy.hpp>
+#include <boost/safe_float/policy/error_free_transformation.hpp>
+
+namespace boost {
+namespace safe_float{
+namespace policy{
+
+/**
+ * Checks the multiplication is exact with an error-free transformation, in both the fenv and the software builds.
+ * Unlike check_multiplication_inexact, no FE_* flag is used and the check can be inlined and vectorized.
+ */
+template<class FP>
+class check_multiplication_inexact_eft : public check_policy<FP> {
+public:
+    static constexpr failure_category multiplication_failure_category = failure_category::inexact;
+
+    constexpr bool post_multiplication_check(const FP& lhs, const FP& rhs, const FP& result){
+        return eft::multiplication_is_exact<FP>(lhs, rhs, result);
+    }
+
+    std::string multiplication_failure_message(){
+        return std::string("Non reversible multiplication applied");
+    }
+
+};
+
+}
+}
+}
+#endif // BOOST_SAFE_FLOAT_POLICY_CHECK_MULTIPLICATION_INEXACT_EFT_HPP
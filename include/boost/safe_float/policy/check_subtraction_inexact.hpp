@@ -2,6 +2,8 @@
 #define BOOST_SAFE_FLOAT_POLICY_CHECK_SUBTRACTION_INEXACT_HPP
 
 #include <boost/safe_float/policy/check_base_policy.hpp>
+#include <boost/safe_float/policy/classify.hpp>
+#include <boost/safe_float/policy/fenv_flags.hpp>
 
 #ifdef FENV_AVAILABLE
 #pragma STDC FENV_ACCESS ON
@@ -14,29 +16,25 @@ namespace policy{
 
 template<class FP>
 class check_subtraction_inexact : public check_policy<FP> {
-#ifndef FENV_AVAILABLE
-    FP prev_l=0;
-    FP prev_r=0;
-#endif
 public:
-    bool pre_subtraction_check(const FP& lhs, const FP& rhs)
+    static constexpr failure_category subtraction_failure_category = failure_category::inexact;
+#ifdef FENV_AVAILABLE
+    static constexpr int subtraction_fenv_flags = FE_INEXACT;
+#endif
+    constexpr bool pre_subtraction_check(const FP& lhs, const FP& rhs)
     {
-#ifndef FENV_AVAILABLE
-        prev_l = lhs;
-        prev_r = rhs;
-        return true;
-#else
-        return ! std::feclearexcept(FE_INEXACT);
+#ifdef FENV_AVAILABLE
+        if (fenv_flags::in_use<FP>()) return fenv_flags::clear<FP>(FE_INEXACT);
 #endif
+        return true;
     }
 
-    bool post_subtraction_check(const FP& rhs)
+    constexpr bool post_subtraction_check(const FP& lhs, const FP& rhs, const FP& result)
     {
-#ifndef FENV_AVAILABLE
-        return ((rhs + prev_r) == prev_l) && ((prev_l - rhs) == prev_r); //this check is not completely safe, need to do some math to get a proper implementation...
-#else
-        return ! std::fetestexcept(FE_INEXACT);
+#ifdef FENV_AVAILABLE
+        if (fenv_flags::in_use<FP>()) return ! fenv_flags::test<FP>(FE_INEXACT);
 #endif
+        return classify::is_nan(result) || (((result + rhs) == lhs) && ((lhs - result) == rhs)); //this check is not completely safe, need to do some math to get a proper implementation...
     }
 
     std::string subtraction_failure_message() { return std::string("Non reversible subtraction applied");
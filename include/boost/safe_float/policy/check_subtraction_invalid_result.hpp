@@ -2,6 +2,8 @@
 #define BOOST_SAFE_FLOAT_POLICY_CHECK_SUBTRACTION_INVALID_RESULT_HPP
 
 #include <boost/safe_float/policy/check_base_policy.hpp>
+#include <boost/safe_float/policy/classify.hpp>
+#include <boost/safe_float/policy/fenv_flags.hpp>
 
 #ifdef FENV_AVAILABLE
 #pragma STDC FENV_ACCESS ON
@@ -17,19 +19,21 @@ namespace policy{
 template<class FP>
 class check_subtraction_invalid_result : public check_policy<FP> {
 public:
-    bool pre_subtraction_check(const FP& lhs, const FP& rhs){
-#ifndef FENV_AVAILABLE
-        return true;
-#else
-        return ! std::feclearexcept(FE_INVALID);
+    static constexpr failure_category subtraction_failure_category = failure_category::invalid_result;
+#ifdef FENV_AVAILABLE
+    static constexpr int subtraction_fenv_flags = FE_INVALID;
+#endif
+    constexpr bool pre_subtraction_check(const FP& lhs, const FP& rhs){
+#ifdef FENV_AVAILABLE
+        if (fenv_flags::in_use<FP>()) return fenv_flags::clear<FP>(FE_INVALID);
 #endif
+        return true;
     }
-    bool post_subtraction_check(const FP& rhs){
-#ifndef FENV_AVAILABLE
-        return !std::isnan(rhs);
-#else
-        return ! std::fetestexcept(FE_INVALID);
+    constexpr bool post_subtraction_check(const FP& lhs, const FP& rhs, const FP& result){
+#ifdef FENV_AVAILABLE
+        if (fenv_flags::in_use<FP>()) return ! fenv_flags::test<FP>(FE_INVALID);
 #endif
+        return !classify::is_nan(result);
     }
     std::string subtraction_failure_message(){
         return std::string("Invalid result from arithmetic operation obtained");
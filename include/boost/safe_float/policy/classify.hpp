@@ -0,0 +1,276 @@
+#ifndef BOOST_SAFE_FLOAT_POLICY_CLASSIFY_HPP
+#define BOOST_SAFE_FLOAT_POLICY_CLASSIFY_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#if __has_include(<bit>)
+#    include <bit>
+#endif
+
+#include <boost/safe_float/utility.hpp>
+
+// This file defines the classification of FP values used by the software checks of the policies.
+// The values are classified on their IEEE-754 bit pattern: the sign is masked out and the remaining bits are compared
+// as an unsigned integer, one compare decides inf, nan, subnormal or zero. The 80 bits long double of x87 has an
+// explicit integer bit and its exponent and mantissa are tested separately. The types without a known layout, or all
+// of them when BOOST_SAFE_FLOAT_CMATH_CLASSIFICATION is defined, are classified by the <cmath> functions, or the ones
+// of their namespace for the types declared by fp_traits. During a constant evaluation, where neither is available,
+// the values are classified by comparisons.
+
+namespace boost
+{
+namespace safe_float
+{
+namespace policy
+{
+namespace classify
+{
+namespace detail
+{
+template<class TO, class FROM>
+inline TO bit_cast(const FROM& from)
+{
+    static_assert(sizeof(TO) == sizeof(FROM), "bit_cast needs types of the same size");
+#ifdef __cpp_lib_bit_cast
+    return std::bit_cast<TO>(from);
+#else
+    TO to;
+    std::memcpy(&to, &from, sizeof(TO));
+    return to;
+#endif
+}
+
+// Interchange formats: sign bit, exponent and mantissa without integer bit in an unsigned integer of the FP size
+template<class UINT, int EXPONENT_BITS, int MANTISSA_BITS>
+struct ieee_layout
+{
+    using bits = UINT;
+    static constexpr UINT magnitude_mask = (UINT(1) << (EXPONENT_BITS + MANTISSA_BITS)) - 1;
+    static constexpr UINT infinity = ((UINT(1) << EXPONENT_BITS) - 1) << MANTISSA_BITS;
+    static constexpr UINT max_subnormal = (UINT(1) << MANTISSA_BITS) - 1;
+
+    template<class FP>
+    static UINT magnitude(const FP& value)
+    {
+        return bit_cast<UINT>(value) & magnitude_mask;
+    }
+    template<class FP>
+    static bool is_inf(const FP& value)
+    {
+        return magnitude(value) == infinity;
+    }
+    template<class FP>
+    static bool is_nan(const FP& value)
+    {
+        return magnitude(value) > infinity;
+    }
+    template<class FP>
+    static bool is_finite(const FP& value)
+    {
+        return magnitude(value) < infinity;
+    }
+    // 0 wraps to the largest value
+    template<class FP>
+    static bool is_subnormal(const FP& value)
+    {
+        return UINT(magnitude(value) - 1) < max_subnormal;
+    }
+    template<class FP>
+    static bool is_zero(const FP& value)
+    {
+        return magnitude(value) == 0;
+    }
+};
+
+// x87 extended precision: 64 bits mantissa with an explicit integer bit, then 16 bits of sign and exponent
+struct x87_layout
+{
+    struct bits
+    {
+        std::uint64_t mantissa;
+        std::uint16_t sign_exponent;
+        unsigned char padding[sizeof(long double) > 10 ? sizeof(long double) - 10 : 1];
+    };
+    static constexpr std::uint16_t exponent_mask = 0x7fff;
+
+    static bits split(const long double& value) { return bit_cast<bits>(value); }
+    static bool is_inf(const long double& value)
+    {
+        bits const b = split(value);
+        return (b.sign_exponent & exponent_mask) == exponent_mask && b.mantissa == std::uint64_t(1) << 63;
+    }
+    static bool is_nan(const long double& value)
+    {
+        bits const b = split(value);
+        return (b.sign_exponent & exponent_mask) == exponent_mask && (b.mantissa << 1) != 0;
+    }
+    static bool is_finite(const long double& value)
+    {
+        return (split(value).sign_exponent & exponent_mask) != exponent_mask;
+    }
+    static bool is_subnormal(const long double& value)
+    {
+        bits const b = split(value);
+        return (b.sign_exponent & exponent_mask) == 0 && b.mantissa != 0;
+    }
+    static bool is_zero(const long double& value)
+    {
+        bits const b = split(value);
+        return (b.sign_exponent & exponent_mask) == 0 && b.mantissa == 0;
+    }
+};
+
+// <cmath> classification, for the formats without a known layout, or the functions of the FP types found by
+// argument-dependent lookup (see fp_traits.hpp)
+struct cmath_layout
+{
+    template<class FP>
+    static bool is_inf(const FP& value)
+    {
+        using std::isinf;
+        return isinf(value);
+    }
+    template<class FP>
+    static bool is_nan(const FP& value)
+    {
+        using std::isnan;
+        return isnan(value);
+    }
+    template<class FP>
+    static bool is_finite(const FP& value)
+    {
+        using std::isfinite;
+        return isfinite(value);
+    }
+    template<class FP>
+    static bool is_subnormal(const FP& value)
+    {
+        using std::fpclassify;
+        return fpclassify(value) == FP_SUBNORMAL;
+    }
+    template<class FP>
+    static bool is_zero(const FP& value)
+    {
+        return value == 0;
+    }
+};
+
+// comparisons only, for the constant evaluations
+struct constant_layout
+{
+    template<class FP>
+    static constexpr bool is_inf(const FP& value)
+    {
+        return value == std::numeric_limits<FP>::infinity() || value == -std::numeric_limits<FP>::infinity();
+    }
+    template<class FP>
+    static constexpr bool is_nan(const FP& value)
+    {
+        return value != value;
+    }
+    template<class FP>
+    static constexpr bool is_finite(const FP& value)
+    {
+        return !is_inf(value) && !is_nan(value);
+    }
+    template<class FP>
+    static constexpr bool is_subnormal(const FP& value)
+    {
+        return value != 0 && value < std::numeric_limits<FP>::min() && -value < std::numeric_limits<FP>::min();
+    }
+    template<class FP>
+    static constexpr bool is_zero(const FP& value)
+    {
+        return value == 0;
+    }
+};
+
+template<class FP, int DIGITS = std::numeric_limits<FP>::digits, bool IEC559 = std::numeric_limits<FP>::is_iec559>
+struct layout
+{
+    using type = cmath_layout;
+};
+
+template<class FP>
+struct layout<FP, 24, true>
+{
+    using type = std::conditional_t<sizeof(FP) == 4, ieee_layout<std::uint32_t, 8, 23>, cmath_layout>;
+};
+
+template<class FP>
+struct layout<FP, 53, true>
+{
+    using type = std::conditional_t<sizeof(FP) == 8, ieee_layout<std::uint64_t, 11, 52>, cmath_layout>;
+};
+
+#if defined(__SIZEOF_INT128__)
+// __extension__ keeps -pedantic quiet on the non standard type
+__extension__ typedef unsigned __int128 uint128;
+
+template<class FP>
+struct layout<FP, 113, true>
+{
+    using type = std::conditional_t<sizeof(FP) == 16, ieee_layout<uint128, 15, 112>, cmath_layout>;
+};
+#endif
+
+template<>
+struct layout<long double, 64, true>
+{
+    using type = std::conditional_t<sizeof(long double) >= 10, x87_layout, cmath_layout>;
+};
+} // namespace detail
+
+#ifdef BOOST_SAFE_FLOAT_CMATH_CLASSIFICATION
+template<class FP>
+using layout = detail::cmath_layout;
+#else
+template<class FP>
+using layout = typename detail::layout<FP>::type;
+#endif
+
+template<class FP>
+constexpr bool is_inf(const FP& value)
+{
+    if (is_constant_evaluated()) return detail::constant_layout::is_inf(value);
+    return layout<FP>::is_inf(value);
+}
+
+template<class FP>
+constexpr bool is_nan(const FP& value)
+{
+    if (is_constant_evaluated()) return detail::constant_layout::is_nan(value);
+    return layout<FP>::is_nan(value);
+}
+
+template<class FP>
+constexpr bool is_finite(const FP& value)
+{
+    if (is_constant_evaluated()) return detail::constant_layout::is_finite(value);
+    return layout<FP>::is_finite(value);
+}
+
+template<class FP>
+constexpr bool is_subnormal(const FP& value)
+{
+    if (is_constant_evaluated()) return detail::constant_layout::is_subnormal(value);
+    return layout<FP>::is_subnormal(value);
+}
+
+// +0 or -0
+template<class FP>
+constexpr bool is_zero(const FP& value)
+{
+    if (is_constant_evaluated()) return detail::constant_layout::is_zero(value);
+    return layout<FP>::is_zero(value);
+}
+
+} // namespace classify
+} // namespace policy
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_POLICY_CLASSIFY_HPP
@@ -0,0 +1,200 @@
+#ifndef BOOST_SAFE_FLOAT_POLICY_ERROR_FREE_TRANSFORMATION_HPP
+#define BOOST_SAFE_FLOAT_POLICY_ERROR_FREE_TRANSFORMATION_HPP
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#include <boost/safe_float/policy/classify.hpp>
+
+// This file defines exact tests of the rounding of an operation, used by the check_*_inexact_eft policies.
+// An error-free transformation computes the rounding error of an operation as a FP: TwoSum (Knuth) for the addition,
+// fma(lhs, rhs, -result) for the multiplication and the error of result * rhs for the division. The operation is
+// exact when the error is 0. The product errors are representable only away from the underflow range, where the
+// operands are scaled by a power of 2 first. float products and quotients are checked exactly in double. Without
+// FP_FAST_FMA (x86-64 without -mfma) std::fma is a library call, emulated for long double: Dekker's product is used.
+// The tests are constexpr, Dekker's product is used during a constant evaluation as well and std::fma remains for the
+// low range and the large operands, evaluated at compile time by the compilers folding it.
+
+namespace boost
+{
+namespace safe_float
+{
+namespace policy
+{
+namespace eft
+{
+namespace detail
+{
+template<class FP>
+struct wider
+{
+    using type = void;
+};
+
+// float products and quotients have an exact residual in double
+template<>
+struct wider<float>
+{
+    using type = double;
+};
+
+// Results below this magnitude may have a product error below the subnormals
+template<class FP>
+constexpr FP low_range()
+{
+    return std::numeric_limits<FP>::min() / (std::numeric_limits<FP>::epsilon() * std::numeric_limits<FP>::epsilon());
+}
+
+// Scaling moving the operations of the low range out of it
+template<class FP>
+constexpr FP scale()
+{
+    return FP(1) / (std::numeric_limits<FP>::epsilon() * std::numeric_limits<FP>::epsilon()) * 4;
+}
+
+template<class FP>
+constexpr FP abs(const FP& value)
+{
+    return value < 0 ? -value : value;
+}
+
+template<class FP>
+constexpr bool fast_fma()
+{
+#ifdef FP_FAST_FMA
+    if (std::is_same<FP, double>::value) return true;
+#endif
+#ifdef FP_FAST_FMAL
+    if (std::is_same<FP, long double>::value) return true;
+#endif
+    return false;
+}
+
+// 2^(digits / 2) + 1, splits a FP in two halves of digits / 2 bits
+template<class FP>
+constexpr FP dekker_split()
+{
+    FP half = 1;
+    for (int i = 0; i < (std::numeric_limits<FP>::digits + 1) / 2; ++i) half *= 2;
+    return half + 1;
+}
+
+// Rounding error of lhs * rhs rounded to product, exact when the product is not in the low range. Without a fast
+// fma, Dekker's product splits the operands in halves whose products are exact, std::fma remains for the operands
+// large enough for the split to overflow.
+template<class FP>
+constexpr FP product_error(const FP& lhs, const FP& rhs, const FP& product)
+{
+    if (fast_fma<FP>() && !is_constant_evaluated())
+        return std::fma(lhs, rhs, -product);
+    else
+    {
+        constexpr FP split = dekker_split<FP>();
+        constexpr FP split_limit = std::numeric_limits<FP>::max() / split;
+        if (!(abs(lhs) < split_limit && abs(rhs) < split_limit)) return std::fma(lhs, rhs, -product);
+        FP const lhs_split = lhs * split;
+        FP const lhs_high = lhs_split - (lhs_split - lhs);
+        FP const lhs_low = lhs - lhs_high;
+        FP const rhs_split = rhs * split;
+        FP const rhs_high = rhs_split - (rhs_split - rhs);
+        FP const rhs_low = rhs - rhs_high;
+        return ((lhs_high * rhs_high - product) + lhs_high * rhs_low + lhs_low * rhs_high) + lhs_low * rhs_low;
+    }
+}
+
+// Infinite or NaN results: an infinite result from finite operands is an overflow, rounded, the others are exact
+template<class FP>
+constexpr bool non_finite_is_exact(const FP& lhs, const FP& rhs, const FP& result)
+{
+    return !(classify::is_inf(result) && classify::is_finite(lhs) && classify::is_finite(rhs));
+}
+
+template<class FP>
+constexpr bool low_range_multiplication_is_exact(FP lhs, FP rhs, const FP& result)
+{
+    if (result == 0) return lhs == 0 || rhs == 0;
+    // the smaller operand is far from the overflow, the scaled product is normal and its residual representable
+    if (abs(lhs) < abs(rhs))
+    {
+        FP const larger = rhs;
+        rhs = lhs;
+        lhs = larger;
+    }
+    FP const scaled_rhs = rhs * scale<FP>();
+    FP const scaled = lhs * scaled_rhs;
+    return std::fma(lhs, scaled_rhs, -scaled) == 0 && scaled == result * scale<FP>();
+}
+
+template<class FP>
+constexpr bool low_range_division_is_exact(FP lhs, FP rhs, const FP& result)
+{
+    if (result == 0) return lhs == 0;
+    // a non zero quotient of a small dividend is normal once the dividend is scaled
+    FP const scaled_lhs = lhs * scale<FP>();
+    FP const scaled = scaled_lhs / rhs;
+    return std::fma(scaled, rhs, -scaled_lhs) == 0 && scaled == result * scale<FP>();
+}
+} // namespace detail
+
+// lhs + rhs == result exactly
+template<class FP>
+constexpr bool addition_is_exact(const FP& lhs, const FP& rhs, const FP& result)
+{
+    static_assert(std::is_floating_point<FP>::value, "The error-free transformations need a primitive FP");
+    FP const rhs_part = result - lhs;
+    FP const error = (lhs - (result - rhs_part)) + (rhs - rhs_part);
+    return classify::is_finite(result) ? error == 0 : detail::non_finite_is_exact(lhs, rhs, result);
+}
+
+// lhs - rhs == result exactly
+template<class FP>
+constexpr bool subtraction_is_exact(const FP& lhs, const FP& rhs, const FP& result)
+{
+    return addition_is_exact<FP>(lhs, -rhs, result);
+}
+
+// lhs * rhs == result exactly
+template<class FP>
+constexpr bool multiplication_is_exact(const FP& lhs, const FP& rhs, const FP& result)
+{
+    static_assert(std::is_floating_point<FP>::value, "The error-free transformations need a primitive FP");
+    if (!classify::is_finite(result)) return detail::non_finite_is_exact(lhs, rhs, result);
+    using W = typename detail::wider<FP>::type;
+    if constexpr (!std::is_void<W>::value)
+        return W(lhs) * W(rhs) == W(result);
+    else
+    {
+        if (detail::abs(result) < detail::low_range<FP>())
+            return detail::low_range_multiplication_is_exact(lhs, rhs, result);
+        return detail::product_error(lhs, rhs, result) == 0;
+    }
+}
+
+// lhs / rhs == result exactly
+template<class FP>
+constexpr bool division_is_exact(const FP& lhs, const FP& rhs, const FP& result)
+{
+    static_assert(std::is_floating_point<FP>::value, "The error-free transformations need a primitive FP");
+    // the division by zero is exact, it is checked by check_division_by_zero, and x / inf is an exact 0
+    if (!classify::is_finite(result)) return rhs == 0 || detail::non_finite_is_exact(lhs, rhs, result);
+    if (classify::is_inf(rhs)) return true;
+    using W = typename detail::wider<FP>::type;
+    if constexpr (!std::is_void<W>::value)
+        return W(result) * W(rhs) == W(lhs);
+    else
+    {
+        if (detail::abs(lhs) < detail::low_range<FP>())
+            return detail::low_range_division_is_exact(lhs, rhs, result);
+        // result * rhs is exactly lhs when its rounding is lhs and its rounding error 0
+        FP const product = result * rhs;
+        return product == lhs && detail::product_error(result, rhs, product) == 0;
+    }
+}
+
+} // namespace eft
+} // namespace policy
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_POLICY_ERROR_FREE_TRANSFORMATION_HPP
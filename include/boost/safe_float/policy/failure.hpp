@@ -0,0 +1,76 @@
+#ifndef BOOST_SAFE_FLOAT_POLICY_FAILURE_HPP
+#define BOOST_SAFE_FLOAT_POLICY_FAILURE_HPP
+
+#include <string>
+#include <type_traits>
+
+// This file defines the descriptor of a failed arithmetic operation given to the REPORT policies providing
+// report_failure(const failure<FP>&). It is built without allocating, the message is only built on demand.
+
+namespace boost
+{
+namespace safe_float
+{
+namespace policy
+{
+enum class operation_kind : unsigned char
+{
+    addition,
+    subtraction,
+    multiplication,
+    division
+};
+
+// What a check policy detects, policies declare it as <operation>_failure_category
+enum class failure_category : unsigned char
+{
+    unknown,
+    overflow,
+    underflow,
+    inexact,
+    invalid_result,
+    division_by_zero,
+    // an operand was already infinite or NaN
+    non_finite_operand
+};
+
+template<class FP>
+struct failure
+{
+    operation_kind operation;
+    failure_category category;
+    // false when a check failed before the operation was done, result is then meaningless
+    bool has_result;
+    FP lhs;
+    FP rhs;
+    FP result;
+
+    // The message the check policy of the category gives
+    std::string message() const
+    {
+        static const char* const names[] = {"addition", "subtraction", "multiplication", "division"};
+        static const char* const verbs[] = {"add", "subtract", "multiply", "divide"};
+        auto const op = static_cast<unsigned>(operation);
+        switch (category)
+        {
+            case failure_category::overflow:
+                return std::string("Overflow to infinite on ") + names[op] + " operation";
+            case failure_category::underflow: return std::string("Underflow from operation");
+            case failure_category::inexact: return std::string("Non reversible ") + names[op] + " applied";
+            case failure_category::invalid_result:
+                return std::string("Invalid result from arithmetic operation obtained");
+            case failure_category::division_by_zero: return std::string("Division by zero");
+            case failure_category::non_finite_operand:
+                return std::string("Non finite operand on ") + names[op] + " operation";
+            default: return std::string("Failed to ") + verbs[op];
+        }
+    }
+};
+
+static_assert(std::is_trivially_copyable<failure<double>>::value, "failure has to be trivially copyable");
+
+} // namespace policy
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_POLICY_FAILURE_HPP
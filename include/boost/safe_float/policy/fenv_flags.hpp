@@ -0,0 +1,142 @@
+#ifndef BOOST_SAFE_FLOAT_POLICY_FENV_FLAGS_HPP
+#define BOOST_SAFE_FLOAT_POLICY_FENV_FLAGS_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+#include <boost/safe_float/fp_traits.hpp>
+#include <boost/safe_float/utility.hpp>
+
+#ifdef FENV_AVAILABLE
+#pragma STDC FENV_ACCESS ON
+#include <fenv.h>
+#endif
+
+// This file defines the access to the FE_* flags used by the check policies when FENV_AVAILABLE is defined.
+// With BOOST_SAFE_FLOAT_HAS_MXCSR (set by the build when check_has_mxcsr.cpp compiles), float and double flags are
+// read and cleared directly in the SSE control/status register, which inlines to a few instructions. The
+// std::feclearexcept/std::fetestexcept calls remain for the other types, like long double computed by the x87 unit.
+// MXCSR is accessed through volatile asm statements clobbering memory: the compiler sees _mm_getcsr as a pure read,
+// merges the reads done before and after an operation and drops the test. The operations can still be moved across
+// the flag accesses, folded when their operands are known or contracted to a fma with the next operation: fence()
+// pins their operands after the clear and their result before the test.
+
+namespace boost
+{
+namespace safe_float
+{
+namespace policy
+{
+namespace fenv_flags
+{
+#if defined(FENV_AVAILABLE) && defined(BOOST_SAFE_FLOAT_HAS_MXCSR)
+template<class FP>
+constexpr bool uses_mxcsr = std::is_same<FP, float>::value || std::is_same<FP, double>::value;
+
+// The exception bits of MXCSR have the values of the FE_* macros
+static_assert((FE_INVALID | FE_DIVBYZERO | FE_OVERFLOW | FE_UNDERFLOW | FE_INEXACT) == 0x3d,
+              "FE_* macros don't match the MXCSR exception bits");
+
+namespace detail
+{
+inline unsigned int read_csr()
+{
+    unsigned int csr;
+    __asm__ __volatile__("stmxcsr %0" : "=m"(csr) : : "memory");
+    return csr;
+}
+
+inline void write_csr(unsigned int csr)
+{
+    __asm__ __volatile__("ldmxcsr %0" : : "m"(csr) : "memory");
+}
+} // namespace detail
+#else
+template<class FP>
+constexpr bool uses_mxcsr = false;
+#endif
+
+// True when the checks of FP test the FE_* flags: at run time, for the types raising them (see fp_traits.hpp)
+template<class FP>
+constexpr bool in_use() noexcept
+{
+    return fp_traits<FP>::raises_fenv_flags && !is_constant_evaluated();
+}
+
+// Clears the flags, returns true on success
+template<class FP>
+inline bool clear(int flags)
+{
+#ifdef FENV_AVAILABLE
+#ifdef BOOST_SAFE_FLOAT_HAS_MXCSR
+    if constexpr (uses_mxcsr<FP>)
+    {
+        // writing MXCSR stalls the pipeline, skip it when the flags are already clear
+        unsigned int const csr = detail::read_csr();
+        if (csr & flags) detail::write_csr(csr & ~static_cast<unsigned int>(flags));
+        return true;
+    }
+    else
+#endif
+        return !std::feclearexcept(flags);
+#else
+    return true;
+#endif
+}
+
+namespace detail
+{
+// size of the widest vector registers of the target
+#if defined(__AVX512F__)
+constexpr std::size_t vector_register_size = 64;
+#elif defined(__AVX__)
+constexpr std::size_t vector_register_size = 32;
+#else
+constexpr std::size_t vector_register_size = 16;
+#endif
+
+#ifdef FENV_AVAILABLE
+// value is a FP or a vector of FP, kept in a SSE register when it is computed in one and fits in it
+template<bool IN_SSE_REGISTER, class T>
+inline void fence(T& value)
+{
+    if constexpr (IN_SSE_REGISTER && sizeof(T) <= vector_register_size)
+        __asm__ __volatile__("" : "+x"(value));
+    else
+        __asm__ __volatile__("" : "+m"(value));
+}
+#endif
+} // namespace detail
+
+// Forbids the compiler to move the computation of the values across the flag accesses, to fold it at compile time
+// or to contract it with another operation
+template<class FP, class... T>
+constexpr void fence(T&... values)
+{
+#ifdef FENV_AVAILABLE
+    if (in_use<FP>()) (detail::fence<uses_mxcsr<FP>>(values), ...);
+#endif
+}
+
+// Returns the flags raised among the ones given
+template<class FP>
+inline int test(int flags)
+{
+#ifdef FENV_AVAILABLE
+#ifdef BOOST_SAFE_FLOAT_HAS_MXCSR
+    if constexpr (uses_mxcsr<FP>)
+        return static_cast<int>(detail::read_csr()) & flags;
+    else
+#endif
+        return std::fetestexcept(flags);
+#else
+    return 0;
+#endif
+}
+
+} // namespace fenv_flags
+} // namespace policy
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_POLICY_FENV_FLAGS_HPP
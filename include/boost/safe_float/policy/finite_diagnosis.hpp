@@ -0,0 +1,30 @@
+#ifndef BOOST_SAFE_FLOAT_POLICY_FINITE_DIAGNOSIS_HPP
+#define BOOST_SAFE_FLOAT_POLICY_FINITE_DIAGNOSIS_HPP
+
+#include <boost/safe_float/policy/classify.hpp>
+#include <boost/safe_float/policy/failure.hpp>
+
+// This file defines the diagnosis of the check_*_finite policies. Their checks only test the result is finite, the
+// cause is looked for once the check failed: a non finite operand, a division by zero, an invalid operation giving a
+// NaN or an overflow, in this order.
+
+namespace boost
+{
+namespace safe_float
+{
+namespace policy
+{
+template<class FP>
+failure_category diagnose_non_finite(operation_kind operation, const FP& lhs, const FP& rhs, const FP& result)
+{
+    if (!classify::is_finite(lhs) || !classify::is_finite(rhs)) return failure_category::non_finite_operand;
+    if (classify::is_nan(result)) return failure_category::invalid_result;
+    if (operation == operation_kind::division && classify::is_zero(rhs)) return failure_category::division_by_zero;
+    return failure_category::overflow;
+}
+
+} // namespace policy
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_POLICY_FINITE_DIAGNOSIS_HPP
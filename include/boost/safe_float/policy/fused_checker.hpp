@@ -0,0 +1,105 @@
+#ifndef BOOST_SAFE_FLOAT_POLICY_FUSED_CHECKER_HPP
+#define BOOST_SAFE_FLOAT_POLICY_FUSED_CHECKER_HPP
+
+#include <string>
+
+#include <boost/safe_float/policy/fenv_flags.hpp>
+#include <boost/safe_float/policy/policy_composers.hpp>
+#include <boost/safe_float/policy/policy_traits.hpp>
+
+namespace boost
+{
+namespace safe_float
+{
+namespace policy
+{
+namespace detail
+{
+// Handler used while replaying operations to keep the message of the first failure instead of reporting it
+struct capture_failure
+{
+    bool failed = false;
+    std::string message;
+
+    void report_failure(const std::string& s)
+    {
+        if (!failed) message = s;
+        failed = true;
+    }
+};
+
+// One operation checked by the reporting functions of the policy, used to replay the operations of a fused check
+#define BOOST_SAFE_FLOAT_CHECKED_OPERATION(operation, OP)                           \
+    template<typename FP, typename POLICY, typename ERROR_HANDLING>                 \
+    FP checked_##operation(POLICY& p, FP lhs, FP rhs, ERROR_HANDLING& e)            \
+    {                                                                               \
+        policy_traits<FP, POLICY>::report_pre_##operation(p, lhs, rhs, e);          \
+        fenv_flags::fence<FP>(lhs, rhs);                                            \
+        FP result = lhs OP rhs;                                                     \
+        fenv_flags::fence<FP>(result);                                              \
+        policy_traits<FP, POLICY>::report_post_##operation(p, lhs, rhs, result, e); \
+        return result;                                                              \
+    }
+
+BOOST_SAFE_FLOAT_CHECKED_OPERATION(addition, +)
+BOOST_SAFE_FLOAT_CHECKED_OPERATION(subtraction, -)
+BOOST_SAFE_FLOAT_CHECKED_OPERATION(multiplication, *)
+BOOST_SAFE_FLOAT_CHECKED_OPERATION(division, /)
+
+#undef BOOST_SAFE_FLOAT_CHECKED_OPERATION
+} // namespace detail
+
+// Splits a check policy between the part relying on FE_* flags, to be handled once for many operations, and the
+// software part, evaluated for every operation without reporting. Used to check several operations at once, the
+// failing operation is then found by replaying them with the policy_traits reporting functions.
+template<typename FP, typename POLICY>
+struct fused_checker
+{
+    using traits = policy_traits<FP, POLICY>;
+
+#define BOOST_SAFE_FLOAT_FUSED_SINGLE_CHECK(operation)                              \
+    static constexpr int operation##_fenv_flags = traits::operation##_fenv_flags(); \
+    static bool operation##_check(FP const& lhs, FP const& rhs, FP const& result)   \
+    {                                                                               \
+        if constexpr (operation##_fenv_flags != 0)                                  \
+            return true;                                                            \
+        else                                                                        \
+        {                                                                           \
+            POLICY p{};                                                             \
+            return traits::pre_##operation##_check(p, lhs, rhs)                     \
+                   & traits::post_##operation##_check(p, lhs, rhs, result);         \
+        }                                                                           \
+    }
+
+    BOOST_SAFE_FLOAT_FUSED_SINGLE_CHECK(addition)
+    BOOST_SAFE_FLOAT_FUSED_SINGLE_CHECK(subtraction)
+    BOOST_SAFE_FLOAT_FUSED_SINGLE_CHECK(multiplication)
+    BOOST_SAFE_FLOAT_FUSED_SINGLE_CHECK(division)
+
+#undef BOOST_SAFE_FLOAT_FUSED_SINGLE_CHECK
+};
+
+template<typename FP, template<typename> typename... As>
+struct fused_checker<FP, composed_check<FP, As...>>
+{
+#define BOOST_SAFE_FLOAT_FUSED_COMPOSED_CHECK(operation)                                      \
+    static constexpr int operation##_fenv_flags =                                             \
+        (fused_checker<FP, As<FP>>::operation##_fenv_flags | ... | 0);                        \
+    static bool operation##_check(FP const& lhs, FP const& rhs, FP const& result)             \
+    {                                                                                         \
+        return (fused_checker<FP, As<FP>>::operation##_check(lhs, rhs, result) & ... & true); \
+    }
+
+    BOOST_SAFE_FLOAT_FUSED_COMPOSED_CHECK(addition)
+    BOOST_SAFE_FLOAT_FUSED_COMPOSED_CHECK(subtraction)
+    BOOST_SAFE_FLOAT_FUSED_COMPOSED_CHECK(multiplication)
+    BOOST_SAFE_FLOAT_FUSED_COMPOSED_CHECK(division)
+
+#undef BOOST_SAFE_FLOAT_FUSED_COMPOSED_CHECK
+};
+
+} // namespace policy
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_POLICY_FUSED_CHECKER_HPP
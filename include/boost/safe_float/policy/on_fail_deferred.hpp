@@ -0,0 +1,97 @@
+#ifndef BOOST_SAFE_FLOAT_POLICY_ON_FAIL_DEFERRED_HPP
+#define BOOST_SAFE_FLOAT_POLICY_ON_FAIL_DEFERRED_HPP
+
+#include <exception>
+#include <string>
+
+#include <boost/safe_float/policy/on_fail_base_policy.hpp>
+#include <boost/safe_float/policy/on_fail_throw.hpp>
+#include <boost/safe_float/policy/policy_traits.hpp>
+
+// This file defines the deferred reporting of failures: the deferred_report policy only records the kind of operation
+// failing in a thread-local status word, the failures are reported once by the checked_region enclosing them.
+
+namespace boost
+{
+namespace safe_float
+{
+namespace policy
+{
+namespace detail
+{
+// failure_code bits of the failures reported since the innermost checked_region of the thread was entered
+inline thread_local unsigned deferred_status = 0;
+
+inline std::string deferred_failure_message(unsigned status)
+{
+    std::string message("Failed operations in checked region:");
+    if (status & failure_code::addition) message += " addition";
+    if (status & failure_code::subtraction) message += " subtraction";
+    if (status & failure_code::multiplication) message += " multiplication";
+    if (status & failure_code::division) message += " division";
+    if (status & failure_code::other) message += " other";
+    return message;
+}
+} // namespace detail
+
+/**
+ * Handler recording the failures in the status word of the thread, to be reported by a checked_region
+ */
+class deferred_report : public on_fail_policy
+{
+public:
+    void report_failure_code(unsigned code) noexcept { detail::deferred_status |= code; }
+    void report_failure(const std::string&) noexcept { detail::deferred_status |= failure_code::other; }
+};
+
+} // namespace policy
+
+/**
+ * RAII object collecting the failures recorded by deferred_report while it lives, they are forwarded once to the
+ * ERROR_HANDLING policy when the region is destroyed or commit() is called.
+ * Regions can be nested, each one reports the failures happening while it is the innermost one.
+ */
+template<class ERROR_HANDLING = policy::on_fail_throw>
+class checked_region : private ERROR_HANDLING
+{
+    unsigned previous_status;
+    int uncaught;
+
+    ERROR_HANDLING& handler() noexcept { return static_cast<ERROR_HANDLING&>(*this); }
+
+public:
+    explicit checked_region(ERROR_HANDLING handler = ERROR_HANDLING{}) :
+        ERROR_HANDLING(handler), previous_status(policy::detail::deferred_status), uncaught(std::uncaught_exceptions())
+    {
+        policy::detail::deferred_status = 0;
+    }
+
+    checked_region(const checked_region&) = delete;
+    checked_region& operator=(const checked_region&) = delete;
+
+    // failure_code bits of the failures recorded and not reported yet
+    unsigned status() const noexcept { return policy::detail::deferred_status; }
+
+    // Reports the failures recorded so far, the region keeps collecting the next ones
+    void commit()
+    {
+        unsigned const failed = policy::detail::deferred_status;
+        if (failed == 0) return;
+        policy::detail::deferred_status = 0;
+        handler().report_failure(policy::detail::deferred_failure_message(failed));
+    }
+
+    ~checked_region() noexcept(false)
+    {
+        unsigned const failed = policy::detail::deferred_status;
+        policy::detail::deferred_status = previous_status;
+        // don't report while unwinding the stack for another error
+        if (failed != 0 && std::uncaught_exceptions() == uncaught)
+            handler().report_failure(policy::detail::deferred_failure_message(failed));
+    }
+};
+
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_POLICY_ON_FAIL_DEFERRED_HPP
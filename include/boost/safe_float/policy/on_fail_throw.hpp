@@ -1,14 +1,65 @@
 #ifndef BOOST_SAFE_FLOAT_POLICY_THROW_ON_FAIL_HPP
 #define BOOST_SAFE_FLOAT_POLICY_THROW_ON_FAIL_HPP
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+#include <boost/safe_float/policy/failure.hpp>
 #include <boost/safe_float/policy/on_fail_base_policy.hpp>
 
 namespace boost {
 namespace safe_float{
 namespace policy{
 
+// Exception thrown when an element of a batch operation fails, index() is the first element failing
+class batch_failure : public std::runtime_error {
+public:
+    batch_failure(const std::string& s, std::size_t index) : std::runtime_error(s), failed_index(index) {}
+    std::size_t index() const noexcept { return failed_index; }
+
+private:
+    std::size_t failed_index;
+};
+
+// Exception thrown when lanes of a safe_simd operation fail, bit i of lanes() is set when lane i failed
+class lane_failure : public std::runtime_error {
+public:
+    // first_lane() of a failure without lane set
+    static constexpr std::size_t no_lane = 64;
+
+    lane_failure(const std::string& s, std::uint64_t lanes) : std::runtime_error(s), failed_lanes(lanes) {}
+    std::uint64_t lanes() const noexcept { return failed_lanes; }
+    // the lane the message was given for, no_lane when no lane is set
+    std::size_t first_lane() const noexcept
+    {
+        if (failed_lanes == 0) return no_lane;
+        std::size_t lane = 0;
+        while (!(failed_lanes & (std::uint64_t(1) << lane))) ++lane;
+        return lane;
+    }
+
+private:
+    std::uint64_t failed_lanes;
+};
+
+// Exception thrown when an arithmetic operation fails, descriptor() gives the operation, the category and the values
+template<class FP>
+class arithmetic_failure : public std::runtime_error {
+public:
+    explicit arithmetic_failure(const failure<FP>& f) : std::runtime_error(f.message()), described(f) {}
+    const failure<FP>& descriptor() const noexcept { return described; }
+
+private:
+    failure<FP> described;
+};
+
 class on_fail_throw : public on_fail_policy {
 public:
     void report_failure(const std::string& s) { throw std::runtime_error(s); }
+    template<class FP>
+    void report_failure(const failure<FP>& f) { throw arithmetic_failure<FP>(f); }
+    void report_batch_failure(const std::string& s, std::size_t index) { throw batch_failure(s, index); }
+    void report_lane_failure(const std::string& s, std::uint64_t lanes) { throw lane_failure(s, lanes); }
 };
 
 }
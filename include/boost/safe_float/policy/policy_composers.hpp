@@ -4,6 +4,7 @@
 #include <algorithm>
 
 #include <boost/safe_float/policy/check_base_policy.hpp>
+#include <boost/safe_float/policy/fenv_flags.hpp>
 #include <boost/safe_float/policy/policy_traits.hpp>
 #include <boost/safe_float/utility.hpp>
 // this file define composers for policies
@@ -15,82 +16,126 @@ namespace safe_float
 namespace policy
 {
 // check_composer
+// Sub-policies declaring the FE_* flags they use (<operation>_fenv_flags) don't get their checks called one by one,
+// instead the union of their flags is cleared once before the operation and tested once after it.
+// Sub-policies are stateless, the composition is then an empty class whatever the number of policies composed.
+// During a constant evaluation, where the flags aren't available, every sub-policy does its own software check.
 template<class FP, template<class> class... As>
-class composed_check : private As<FP>...
+class composed_check
 {
     // TODO add static check for As to be va;id check Policies.
+    static_assert((std::is_empty_v<As<FP>> && ... && true), "Composed check policies have to be stateless");
+
     friend policy_traits<FP, composed_check, true>;
 
-public:
-    // operator+
-    bool pre_addition_check(const FP& lhs, const FP& rhs)
-    {
-        return (policy_traits<FP, As<FP>>::pre_addition_check(static_cast<As<FP>&>(*this), lhs, rhs) && ... && true);
-    }
+    template<template<class> class A>
+    inline static A<FP> sub_policy_instance{};
 
-    bool post_addition_check(const FP& value)
+    template<template<class> class A>
+    static constexpr A<FP>& sub_policy() noexcept
     {
-        return (policy_traits<FP, As<FP>>::post_addition_check(static_cast<As<FP>&>(*this), value) && ... && true);
+        return sub_policy_instance<A>;
     }
 
-    std::string addition_failure_message()
-    {
-        // TODO: find out the message from the policy broken
-        return std::string("Policy broken when adding");
-    }
+#define BOOST_SAFE_FLOAT_COMPOSED_FENV_FLAGS(operation)      \
+    static constexpr int fused_##operation##_fenv_flags = \
+        (policy_traits<FP, As<FP>>::operation##_fenv_flags() | ... | 0);
 
-    // operator-
-    bool pre_subtraction_check(const FP& lhs, const FP& rhs)
-    {
-        return (policy_traits<FP, As<FP>>::pre_subtraction_check(static_cast<As<FP>&>(*this), lhs, rhs) && ... && true);
-    }
+    BOOST_SAFE_FLOAT_COMPOSED_FENV_FLAGS(addition)
+    BOOST_SAFE_FLOAT_COMPOSED_FENV_FLAGS(subtraction)
+    BOOST_SAFE_FLOAT_COMPOSED_FENV_FLAGS(multiplication)
+    BOOST_SAFE_FLOAT_COMPOSED_FENV_FLAGS(division)
 
-    bool post_subtraction_check(const FP& value)
-    {
-        return (policy_traits<FP, As<FP>>::post_subtraction_check(static_cast<As<FP>&>(*this), value) && ... && true);
-    }
+#undef BOOST_SAFE_FLOAT_COMPOSED_FENV_FLAGS
 
-    std::string subtraction_failure_message()
+    // The checks record the sub-policy found broken, so the failure message and category are the ones of that policy.
+    // The message of a sub-policy diagnosing its failures is the one of the category diagnosed
+    struct failed_policy
     {
-        // TODO: find out the message from the policy broken
-        return std::string("Policy broken when subtracting");
+        std::string (*message)() = nullptr;
+        failure_category category = failure_category::unknown;
+    };
+
+#define BOOST_SAFE_FLOAT_COMPOSED_FAILED_POLICY(operation)                                                          \
+    inline static thread_local failed_policy operation##_failed{};                                                  \
+                                                                                                                    \
+    template<template<class> class A>                                                                               \
+    static constexpr bool operation##_record(bool passed, const FP& lhs, const FP& rhs, const FP& result) noexcept  \
+    {                                                                                                               \
+        if (!passed && !is_constant_evaluated())                                                                    \
+        {                                                                                                           \
+            using traits = policy_traits<FP, A<FP>>;                                                                \
+            std::string (*message)() = nullptr;                                                                     \
+            if constexpr (!traits::diagnoses_##operation())                                                         \
+                message = [] { return sub_policy<A>().operation##_failure_message(); };                             \
+            operation##_failed = {message, traits::operation##_failed_category(sub_policy<A>(), lhs, rhs, result)}; \
+        }                                                                                                           \
+        return passed;                                                                                              \
     }
 
-    // operator*
-    bool pre_multiplication_check(const FP& lhs, const FP& rhs)
-    {
-        return (policy_traits<FP, As<FP>>::pre_multiplication_check(static_cast<As<FP>&>(*this), lhs, rhs) && ...
-                && true);
-    }
+    BOOST_SAFE_FLOAT_COMPOSED_FAILED_POLICY(addition)
+    BOOST_SAFE_FLOAT_COMPOSED_FAILED_POLICY(subtraction)
+    BOOST_SAFE_FLOAT_COMPOSED_FAILED_POLICY(multiplication)
+    BOOST_SAFE_FLOAT_COMPOSED_FAILED_POLICY(division)
 
-    bool post_multiplication_check(const FP& value)
-    {
-        return (policy_traits<FP, As<FP>>::post_multiplication_check(static_cast<As<FP>&>(*this), value) && ...
-                && true);
-    }
+#undef BOOST_SAFE_FLOAT_COMPOSED_FAILED_POLICY
 
-    std::string multiplication_failure_message()
-    {
-        // TODO: find out the message from the policy broken
-        return std::string("Policy broken when multiplying");
-    }
+public:
+#define BOOST_SAFE_FLOAT_COMPOSED_CHECKS(operation, generic_message)                                           \
+    constexpr bool pre_##operation##_check(const FP& lhs, const FP& rhs)                                       \
+    {                                                                                                          \
+        bool const fused = !is_constant_evaluated();                                                           \
+        if constexpr (fused_##operation##_fenv_flags != 0)                                                     \
+        {                                                                                                      \
+            if (fused) fenv_flags::clear<FP>(fused_##operation##_fenv_flags);                                  \
+        }                                                                                                      \
+        return (((fused && policy_traits<FP, As<FP>>::operation##_fenv_flags() != 0)                           \
+                 || operation##_record<As>(                                                                    \
+                     policy_traits<FP, As<FP>>::pre_##operation##_check(sub_policy<As>(), lhs, rhs), lhs, rhs, \
+                     FP{}))                                                                                    \
+                && ... && true);                                                                               \
+    }                                                                                                          \
+                                                                                                               \
+    constexpr bool post_##operation##_check(const FP& lhs, const FP& rhs, const FP& result)                    \
+    {                                                                                                          \
+        bool const fused = !is_constant_evaluated();                                                           \
+        if constexpr (fused_##operation##_fenv_flags != 0)                                                     \
+        {                                                                                                      \
+            int const raised = fused ? fenv_flags::test<FP>(fused_##operation##_fenv_flags) : 0;               \
+            if (raised)                                                                                        \
+                return ((!(raised & policy_traits<FP, As<FP>>::operation##_fenv_flags())                       \
+                         || operation##_record<As>(false, lhs, rhs, result))                                   \
+                        && ... && true);                                                                       \
+        }                                                                                                      \
+        return (((fused && policy_traits<FP, As<FP>>::operation##_fenv_flags() != 0)                           \
+                 || operation##_record<As>(                                                                    \
+                     policy_traits<FP, As<FP>>::post_##operation##_check(sub_policy<As>(), lhs, rhs, result),  \
+                     lhs, rhs, result))                                                                        \
+                && ... && true);                                                                               \
+    }                                                                                                          \
+                                                                                                               \
+    /* Message of the sub-policy broken by the last failing check of the thread */                             \
+    std::string operation##_failure_message()                                                                  \
+    {                                                                                                          \
+        if (operation##_failed.message) return operation##_failed.message();                                   \
+        if (operation##_failed.category != failure_category::unknown)                                          \
+            return failure<FP>{operation_kind::operation, operation##_failed.category, true, FP{}, FP{}, FP{}} \
+                .message();                                                                                    \
+        return std::string(generic_message);                                                                   \
+    }                                                                                                          \
+                                                                                                               \
+    failure_category operation##_failed_category() const noexcept { return operation##_failed.category; }
 
+    // operator+
+    BOOST_SAFE_FLOAT_COMPOSED_CHECKS(addition, "Policy broken when adding")
+    // operator-
+    BOOST_SAFE_FLOAT_COMPOSED_CHECKS(subtraction, "Policy broken when subtracting")
+    // operator*
+    BOOST_SAFE_FLOAT_COMPOSED_CHECKS(multiplication, "Policy broken when multiplying")
     // operator/
-    bool pre_division_check(const FP& lhs, const FP& rhs)
-    {
-        return (policy_traits<FP, As<FP>>::pre_division_check(static_cast<As<FP>&>(*this), lhs, rhs) && ... && true);
-    }
-
-    bool post_division_check(const FP& value)
-    {
-        return (policy_traits<FP, As<FP>>::post_division_check(static_cast<As<FP>&>(*this), value) && ... && true);
-    }
+    BOOST_SAFE_FLOAT_COMPOSED_CHECKS(division, "Policy broken when dividing")
 
-    std::string division_failure_message()
-    {
-        // TODO: find out the message from the policy broken
-        return std::string("Policy broken when dividing");
-    }
+#undef BOOST_SAFE_FLOAT_COMPOSED_CHECKS
 };
 
 template<template<typename> typename... POLICIES>
@@ -107,19 +152,27 @@ class policy_traits<FP, composed_check<FP, As...>, true> : public policy_traits<
     using parent = policy_traits<FP, composed_check<FP, As...>, false>;
 
 public:
-#define BOOST_SAFE_FLOAT_POLICY_REPORT_PRE_CHECK_ERROR(operation)                                  \
-    template<typename ERROR_HANDLING>                                                              \
-    static void report_pre_##operation(Policy& p, FP const& lhs, FP const& rhs, ERROR_HANDLING& e) \
-    {                                                                                              \
-        if constexpr (parent::has_pre_##operation##_check())                                       \
-        {                                                                                          \
-            (                                                                                      \
-                [&]() {                                                                            \
-                    auto& pol = static_cast<As<FP>&>(p);                                           \
-                    policy_traits<FP, As<FP>>::report_pre_##operation(pol, lhs, rhs, e);           \
-                }(),                                                                               \
-                ...);                                                                              \
-        }                                                                                          \
+#define BOOST_SAFE_FLOAT_POLICY_REPORT_PRE_CHECK_ERROR(operation)                                            \
+    template<typename ERROR_HANDLING>                                                                        \
+    static constexpr void report_pre_##operation(Policy& p, FP const& lhs, FP const& rhs, ERROR_HANDLING& e) \
+    {                                                                                                        \
+        if constexpr (parent::has_pre_##operation##_check())                                                 \
+        {                                                                                                    \
+            bool const fused = !is_constant_evaluated();                                                     \
+            if constexpr (Policy::fused_##operation##_fenv_flags != 0)                                       \
+            {                                                                                                \
+                if (fused) fenv_flags::clear<FP>(Policy::fused_##operation##_fenv_flags);                    \
+            }                                                                                                \
+            (                                                                                                \
+                [&]() {                                                                                      \
+                    if (!fused || policy_traits<FP, As<FP>>::operation##_fenv_flags() == 0)                  \
+                    {                                                                                        \
+                        auto& pol = Policy::template sub_policy<As>();                                       \
+                        policy_traits<FP, As<FP>>::report_pre_##operation(pol, lhs, rhs, e);                 \
+                    }                                                                                        \
+                }(),                                                                                         \
+                ...);                                                                                        \
+        }                                                                                                    \
     }
 
     BOOST_SAFE_FLOAT_POLICY_REPORT_PRE_CHECK_ERROR(addition)
@@ -129,19 +182,41 @@ public:
 
 #undef BOOST_SAFE_FLOAT_POLICY_REPORT_PRE_CHECK_ERROR
 
-#define BOOST_SAFE_FLOAT_POLICY_REPORT_POST_CHECK_ERROR(operation)                        \
-    template<typename ERROR_HANDLING>                                                     \
-    static void report_post_##operation(Policy& p, FP const& value, ERROR_HANDLING& e)    \
-    {                                                                                     \
-        if constexpr (parent::has_pre_##operation##_check())                              \
-        {                                                                                 \
-            (                                                                             \
-                [&]() {                                                                   \
-                    auto& pol = static_cast<As<FP>&>(p);                                  \
-                    policy_traits<FP, As<FP>>::report_post_##operation(pol, value, e); \
-                }(),                                                                      \
-                ...);                                                                     \
-        }                                                                                 \
+    // The fused flags are tested once, then every sub-policy is visited in order so the first one broken reports.
+    // During a constant evaluation every sub-policy reports its own software check.
+#define BOOST_SAFE_FLOAT_POLICY_REPORT_POST_CHECK_ERROR(operation)                                           \
+    template<typename ERROR_HANDLING>                                                                        \
+    static constexpr void report_post_##operation(Policy& p, FP const& lhs, FP const& rhs, FP const& result, \
+                                                  ERROR_HANDLING& e)                                         \
+    {                                                                                                        \
+        if constexpr (parent::has_post_##operation##_check())                                                \
+        {                                                                                                    \
+            bool const fused = !is_constant_evaluated();                                                     \
+            [[maybe_unused]] int raised = 0;                                                                 \
+            if constexpr (Policy::fused_##operation##_fenv_flags != 0)                                       \
+            {                                                                                                \
+                if (fused) raised = fenv_flags::test<FP>(Policy::fused_##operation##_fenv_flags);            \
+            }                                                                                                \
+            (                                                                                                \
+                [&]() {                                                                                      \
+                    auto& pol = Policy::template sub_policy<As>();                                           \
+                    if (fused && policy_traits<FP, As<FP>>::operation##_fenv_flags() != 0)                   \
+                    {                                                                                        \
+                        if (raised & policy_traits<FP, As<FP>>::operation##_fenv_flags())                    \
+                            helper::report_failure(                                                          \
+                                e,                                                                           \
+                                failure<FP>{operation_kind::operation,                                       \
+                                            policy_traits<FP, As<FP>>::operation##_failure_category(),       \
+                                            true, lhs, rhs, result},                                         \
+                                [&] { return pol.operation##_failure_message(); });                          \
+                    }                                                                                        \
+                    else                                                                                     \
+                    {                                                                                        \
+                        policy_traits<FP, As<FP>>::report_post_##operation(pol, lhs, rhs, result, e);        \
+                    }                                                                                        \
+                }(),                                                                                         \
+                ...);                                                                                        \
+        }                                                                                                    \
     }
 
     BOOST_SAFE_FLOAT_POLICY_REPORT_POST_CHECK_ERROR(addition)
@@ -152,6 +227,41 @@ public:
 #undef BOOST_SAFE_FLOAT_POLICY_REPORT_POST_CHECK_ERROR
 };
 
+// The operations on which a check policy detects the failures of a category, and whether it detects failures of other
+// categories. A composition detects the ones of its sub-policies.
+template<typename FP, typename POLICY, failure_category CATEGORY>
+struct detected_category
+{
+    using traits = policy_traits<FP, POLICY>;
+    static constexpr bool addition = traits::addition_failure_category() == CATEGORY;
+    static constexpr bool subtraction = traits::subtraction_failure_category() == CATEGORY;
+    static constexpr bool multiplication = traits::multiplication_failure_category() == CATEGORY;
+    static constexpr bool division = traits::division_failure_category() == CATEGORY;
+
+    static constexpr bool is_other(failure_category c) { return c != CATEGORY && c != failure_category::unknown; }
+    static constexpr bool others = is_other(traits::addition_failure_category())
+                                   || is_other(traits::subtraction_failure_category())
+                                   || is_other(traits::multiplication_failure_category())
+                                   || is_other(traits::division_failure_category());
+};
+
+template<typename FP, template<typename> typename... As, failure_category CATEGORY>
+struct detected_category<FP, composed_check<FP, As...>, CATEGORY>
+{
+    static constexpr bool addition = (detected_category<FP, As<FP>, CATEGORY>::addition || ...);
+    static constexpr bool subtraction = (detected_category<FP, As<FP>, CATEGORY>::subtraction || ...);
+    static constexpr bool multiplication = (detected_category<FP, As<FP>, CATEGORY>::multiplication || ...);
+    static constexpr bool division = (detected_category<FP, As<FP>, CATEGORY>::division || ...);
+    static constexpr bool others = (detected_category<FP, As<FP>, CATEGORY>::others || ...);
+};
+
+// A check policy detecting the failures of the category on every operation, and no other failure
+template<typename FP, typename POLICY, failure_category CATEGORY>
+constexpr bool checks_only_category =
+    detected_category<FP, POLICY, CATEGORY>::addition && detected_category<FP, POLICY, CATEGORY>::subtraction
+    && detected_category<FP, POLICY, CATEGORY>::multiplication && detected_category<FP, POLICY, CATEGORY>::division
+    && !detected_category<FP, POLICY, CATEGORY>::others;
+
 // on_fail_composer
 
 // cast_composer
@@ -189,7 +299,7 @@ template<typename FP, template<typename> typename FIRST, template<typename> type
 struct construct_implicit<FP, FIRST, REST...>
 {
     template<typename T>
-    static void construct(FP& target, T source)
+    static constexpr void construct(FP& target, T source)
     {
         if constexpr (FIRST<FP>::template can_cast_from<T>)
         {
@@ -206,7 +316,7 @@ template<typename FP>
 struct construct_implicit<FP>
 {
     template<typename T>
-    static void construct(FP& target, T source)
+    static constexpr void construct(FP& target, T source)
     {}
 };
 
@@ -218,7 +328,7 @@ template<typename FP, template<typename> typename FIRST, template<typename> type
 struct construct_explicit<FP, FIRST, REST...>
 {
     template<typename T>
-    static void construct(FP& target, T source)
+    static constexpr void construct(FP& target, T source)
     {
         if constexpr (FIRST<FP>::template can_cast_from<T> || FIRST<FP>::template can_explicitly_cast_from<T>)
         {
@@ -235,7 +345,7 @@ template<typename FP>
 struct construct_explicit<FP>
 {
     template<typename T>
-    static void construct(FP& target, T source)
+    static constexpr void construct(FP& target, T source)
     {}
 };
 } // namespace helper
@@ -246,23 +356,23 @@ struct cast_helper<FP, composed_cast<FP, As...>>
     using CAST_POLICY = composed_cast<FP, As...>;
 
     template<typename T, std::enable_if_t<CAST_POLICY::template can_cast_from<T>, int> = 0>
-    static void construct_implicitly(FP& target, T source)
+    static constexpr void construct_implicitly(FP& target, T source)
     {
         helper::construct_implicit<FP, As...>::template construct<T>(target, source);
     }
     template<typename T, std::enable_if_t<CAST_POLICY::template can_explicitly_cast_from<T>, int> = 0>
-    static void construct_explicitly(FP& target, T source)
+    static constexpr void construct_explicitly(FP& target, T source)
     {
         helper::construct_explicit<FP, As...>::template construct<T>(target, source);
     }
 
     template<typename T, std::enable_if_t<CAST_POLICY::template can_cast_from<T>, int> = 0>
-    static T convert_implicitly(FP source)
+    static constexpr T convert_implicitly(FP source)
     {
         CAST_POLICY::template cast_to<T>(source);
     }
     template<typename T, std::enable_if_t<CAST_POLICY::template can_explicitly_cast_from<T>, int> = 0>
-    static T convert_explicitly(FP source)
+    static constexpr T convert_explicitly(FP source)
     {
         CAST_POLICY::template cast_to<T>(source);
     }
@@ -2,8 +2,13 @@
 #define BOOST_SAFE_FLOAT_POLICY_TRAITS_HPP
 
 
+#include <string>
 #include <type_traits>
+#include <utility>
 
+#include <boost/safe_float/fp_traits.hpp>
+#include <boost/safe_float/policy/failure.hpp>
+#include <boost/safe_float/utility.hpp>
 
 namespace boost
 {
@@ -27,6 +32,70 @@ namespace policy
     BOOST_SAFE_FLOAT_EVERY_PRE_CHECK(OP) \
     BOOST_SAFE_FLOAT_EVERY_POST_CHECK(OP)
 
+// Compact identification of the failing operation, given to the handlers providing report_failure_code(unsigned)
+// instead of the message. The bit of an arithmetic operation is 1 << operation_kind.
+namespace failure_code
+{
+constexpr unsigned addition = 1u << static_cast<unsigned>(operation_kind::addition);
+constexpr unsigned subtraction = 1u << static_cast<unsigned>(operation_kind::subtraction);
+constexpr unsigned multiplication = 1u << static_cast<unsigned>(operation_kind::multiplication);
+constexpr unsigned division = 1u << static_cast<unsigned>(operation_kind::division);
+// failures reported with a message only, like the casts
+constexpr unsigned other = 1u << 4;
+} // namespace failure_code
+
+namespace helper
+{
+template<typename ERROR_HANDLING, typename = std::void_t<>>
+struct has_report_failure_code : std::false_type
+{};
+
+template<typename ERROR_HANDLING>
+struct has_report_failure_code<ERROR_HANDLING,
+                               std::void_t<decltype(std::declval<ERROR_HANDLING&>().report_failure_code(0u))>> :
+    std::true_type
+{};
+
+template<typename ERROR_HANDLING, typename FP, typename = std::void_t<>>
+struct has_report_failure_descriptor : std::false_type
+{};
+
+template<typename ERROR_HANDLING, typename FP>
+struct has_report_failure_descriptor<
+    ERROR_HANDLING, FP,
+    std::void_t<decltype(std::declval<ERROR_HANDLING&>().report_failure(std::declval<const failure<FP>&>()))>> :
+    std::true_type
+{};
+
+// Reached instead of the handler by a check failing during a constant evaluation. It is not constexpr: the evaluation
+// stops and the compiler reports this call as the reason the expression is not a constant.
+template<typename FP>
+void check_failed_during_constant_evaluation(failure<FP> const&) noexcept
+{}
+
+// Reports a failure to the handler: the code of the operation to the handlers providing report_failure_code, the
+// descriptor to the ones taking it when the category is known, the message otherwise.
+// The message is only built in the last case.
+template<typename FP, typename ERROR_HANDLING, typename MESSAGE>
+void report_failure(ERROR_HANDLING& e, failure<FP> const& f, MESSAGE&& message)
+{
+    if constexpr (has_report_failure_code<ERROR_HANDLING>::value)
+        e.report_failure_code(1u << static_cast<unsigned>(f.operation));
+    else
+    {
+        if constexpr (has_report_failure_descriptor<ERROR_HANDLING, FP>::value)
+        {
+            if (f.category != failure_category::unknown)
+            {
+                e.report_failure(f);
+                return;
+            }
+        }
+        e.report_failure(std::forward<MESSAGE>(message)());
+    }
+}
+} // namespace helper
+
 namespace detection
 {
 template<typename FP, typename Policy, template<typename, typename> typename Capacity, typename = std::void_t<>>
@@ -45,14 +114,67 @@ BOOST_SAFE_FLOAT_EVERY_PRE_CHECK(BOOST_SAFE_FLOAT_TEST_PRE_CHECK_CAPACITY_TEMPLA
 
 #undef BOOST_SAFE_FLOAT_TEST_PRE_CHECK_CAPACITY_TEMPLATE
 
-#define BOOST_SAFE_FLOAT_TEST_POST_CHECK_CAPACITY_TEMPLATE(capacity) \
-    template<typename FP, typename Policy>                           \
-    using has_##capacity = decltype(std::declval<Policy>().capacity(std::declval<FP>()));
+#define BOOST_SAFE_FLOAT_TEST_POST_CHECK_CAPACITY_TEMPLATE(capacity)                                           \
+    template<typename FP, typename Policy>                                                                     \
+    using has_##capacity =                                                                                     \
+        decltype(std::declval<Policy>().capacity(std::declval<FP>(), std::declval<FP>(), std::declval<FP>()));
 
 BOOST_SAFE_FLOAT_EVERY_POST_CHECK(BOOST_SAFE_FLOAT_TEST_POST_CHECK_CAPACITY_TEMPLATE)
 
 #undef BOOST_SAFE_FLOAT_TEST_POST_CHECK_CAPACITY_TEMPLATE
 
+// A policy declaring <operation>_fenv_flags states that its pre check only clears those FE_* flags
+// and its post check only tests them, so a composition can merge the flag handling of several policies
+// The flags of a FP whose operations don't raise them are ignored, see fp_traits.hpp
+#define BOOST_SAFE_FLOAT_TEST_FENV_FLAGS_TEMPLATE(operation) \
+    template<typename FP, typename Policy>                  \
+    using has_##operation##_fenv_flags = decltype(Policy::operation##_fenv_flags);
+
+BOOST_SAFE_FLOAT_TEST_FENV_FLAGS_TEMPLATE(addition)
+BOOST_SAFE_FLOAT_TEST_FENV_FLAGS_TEMPLATE(subtraction)
+BOOST_SAFE_FLOAT_TEST_FENV_FLAGS_TEMPLATE(multiplication)
+BOOST_SAFE_FLOAT_TEST_FENV_FLAGS_TEMPLATE(division)
+
+#undef BOOST_SAFE_FLOAT_TEST_FENV_FLAGS_TEMPLATE
+
+// The failure_category a policy detects for an operation, reported in the failure descriptor
+#define BOOST_SAFE_FLOAT_TEST_FAILURE_CATEGORY_TEMPLATE(operation) \
+    template<typename FP, typename Policy>                        \
+    using has_##operation##_failure_category = decltype(Policy::operation##_failure_category);
+
+BOOST_SAFE_FLOAT_TEST_FAILURE_CATEGORY_TEMPLATE(addition)
+BOOST_SAFE_FLOAT_TEST_FAILURE_CATEGORY_TEMPLATE(subtraction)
+BOOST_SAFE_FLOAT_TEST_FAILURE_CATEGORY_TEMPLATE(multiplication)
+BOOST_SAFE_FLOAT_TEST_FAILURE_CATEGORY_TEMPLATE(division)
+
+#undef BOOST_SAFE_FLOAT_TEST_FAILURE_CATEGORY_TEMPLATE
+
+// The policies recording the cause of a failure when it happens give its category as <operation>_failed_category()
+#define BOOST_SAFE_FLOAT_TEST_FAILED_CATEGORY_TEMPLATE(operation) \
+    template<typename FP, typename Policy>                        \
+    using has_##operation##_failed_category = decltype(std::declval<Policy&>().operation##_failed_category());
+
+BOOST_SAFE_FLOAT_TEST_FAILED_CATEGORY_TEMPLATE(addition)
+BOOST_SAFE_FLOAT_TEST_FAILED_CATEGORY_TEMPLATE(subtraction)
+BOOST_SAFE_FLOAT_TEST_FAILED_CATEGORY_TEMPLATE(multiplication)
+BOOST_SAFE_FLOAT_TEST_FAILED_CATEGORY_TEMPLATE(division)
+
+#undef BOOST_SAFE_FLOAT_TEST_FAILED_CATEGORY_TEMPLATE
+
+// The policies diagnosing a failure from the operands and the result give its category as
+// <operation>_failed_category(lhs, rhs, result), only called once the check failed
+#define BOOST_SAFE_FLOAT_TEST_DIAGNOSIS_TEMPLATE(operation)                                           \
+    template<typename FP, typename Policy>                                                            \
+    using has_##operation##_diagnosis = decltype(std::declval<Policy&>().operation##_failed_category( \
+        std::declval<const FP&>(), std::declval<const FP&>(), std::declval<const FP&>()));
+
+BOOST_SAFE_FLOAT_TEST_DIAGNOSIS_TEMPLATE(addition)
+BOOST_SAFE_FLOAT_TEST_DIAGNOSIS_TEMPLATE(subtraction)
+BOOST_SAFE_FLOAT_TEST_DIAGNOSIS_TEMPLATE(multiplication)
+BOOST_SAFE_FLOAT_TEST_DIAGNOSIS_TEMPLATE(division)
+
+#undef BOOST_SAFE_FLOAT_TEST_DIAGNOSIS_TEMPLATE
+
 } // namespace detection
 
 
@@ -70,8 +192,87 @@ public:
 
 #undef BOOST_SAFE_FLOAT_TEST_POLICY_CAPACITY
 
+#define BOOST_SAFE_FLOAT_POLICY_FENV_FLAGS(operation)                                               \
+    static constexpr int operation##_fenv_flags() noexcept                                          \
+    {                                                                                               \
+        if constexpr (detection::detect<Fp, Policy, detection::has_##operation##_fenv_flags>::value \
+                      && fp_traits<Fp>::raises_fenv_flags)                                          \
+            return Policy::operation##_fenv_flags;                                                  \
+        else                                                                                        \
+            return 0;                                                                               \
+    }
+
+    BOOST_SAFE_FLOAT_POLICY_FENV_FLAGS(addition)
+    BOOST_SAFE_FLOAT_POLICY_FENV_FLAGS(subtraction)
+    BOOST_SAFE_FLOAT_POLICY_FENV_FLAGS(multiplication)
+    BOOST_SAFE_FLOAT_POLICY_FENV_FLAGS(division)
+
+#undef BOOST_SAFE_FLOAT_POLICY_FENV_FLAGS
+
+#define BOOST_SAFE_FLOAT_POLICY_FAILURE_CATEGORY(operation)                                                \
+    static constexpr failure_category operation##_failure_category() noexcept                              \
+    {                                                                                                      \
+        if constexpr (detection::detect<Fp, Policy, detection::has_##operation##_failure_category>::value) \
+            return Policy::operation##_failure_category;                                                   \
+        else                                                                                               \
+            return failure_category::unknown;                                                              \
+    }
+
+    BOOST_SAFE_FLOAT_POLICY_FAILURE_CATEGORY(addition)
+    BOOST_SAFE_FLOAT_POLICY_FAILURE_CATEGORY(subtraction)
+    BOOST_SAFE_FLOAT_POLICY_FAILURE_CATEGORY(multiplication)
+    BOOST_SAFE_FLOAT_POLICY_FAILURE_CATEGORY(division)
+
+#undef BOOST_SAFE_FLOAT_POLICY_FAILURE_CATEGORY
+
+#define BOOST_SAFE_FLOAT_POLICY_DIAGNOSES(operation)                                         \
+    static constexpr bool diagnoses_##operation() noexcept                                   \
+    {                                                                                        \
+        return detection::detect<Fp, Policy, detection::has_##operation##_diagnosis>::value; \
+    }
+
+    BOOST_SAFE_FLOAT_POLICY_DIAGNOSES(addition)
+    BOOST_SAFE_FLOAT_POLICY_DIAGNOSES(subtraction)
+    BOOST_SAFE_FLOAT_POLICY_DIAGNOSES(multiplication)
+    BOOST_SAFE_FLOAT_POLICY_DIAGNOSES(division)
+
+#undef BOOST_SAFE_FLOAT_POLICY_DIAGNOSES
+
+    // Category of the failure just found by a check of p on lhs, rhs and result, diagnosed from them or recorded by the
+    // check. The policies don't diagnose nor record it during a constant evaluation
+#define BOOST_SAFE_FLOAT_POLICY_FAILED_CATEGORY(operation)                                                     \
+    static constexpr failure_category operation##_failed_category(Policy& p, Fp const& lhs, Fp const& rhs,     \
+                                                                  Fp const& result) noexcept                   \
+    {                                                                                                          \
+        if constexpr (diagnoses_##operation())                                                                 \
+        {                                                                                                      \
+            if (!is_constant_evaluated()) return p.operation##_failed_category(lhs, rhs, result);              \
+        }                                                                                                      \
+        else if constexpr (detection::detect<Fp, Policy, detection::has_##operation##_failed_category>::value) \
+        {                                                                                                      \
+            if (!is_constant_evaluated()) return p.operation##_failed_category();                              \
+        }                                                                                                      \
+        return operation##_failure_category();                                                                 \
+    }                                                                                                          \
+                                                                                                               \
+    /* The message of the failure f found by a check of p, the one of its category when p diagnosed it */      \
+    static std::string operation##_failure_message(Policy& p, failure<Fp> const& f)                            \
+    {                                                                                                          \
+        if constexpr (diagnoses_##operation())                                                                 \
+            return f.message();                                                                                \
+        else                                                                                                   \
+            return p.operation##_failure_message();                                                            \
+    }
+
+    BOOST_SAFE_FLOAT_POLICY_FAILED_CATEGORY(addition)
+    BOOST_SAFE_FLOAT_POLICY_FAILED_CATEGORY(subtraction)
+    BOOST_SAFE_FLOAT_POLICY_FAILED_CATEGORY(multiplication)
+    BOOST_SAFE_FLOAT_POLICY_FAILED_CATEGORY(division)
+
+#undef BOOST_SAFE_FLOAT_POLICY_FAILED_CATEGORY
+
 #define BOOST_SAFE_FLOAT_POLICY_DO_PRE_CHECK(capacity)                                         \
-    static bool pre_##capacity##_check(Policy& p, Fp const& lhs, Fp const& rhs)                \
+    static constexpr bool pre_##capacity##_check(Policy& p, Fp const& lhs, Fp const& rhs)      \
     {                                                                                          \
         if constexpr (has_pre_##capacity##_check()) return p.pre_##capacity##_check(lhs, rhs); \
         return true;                                                                           \
@@ -84,11 +285,11 @@ public:
 
 #undef BOOST_SAFE_FLOAT_POLICY_DO_PRE_CHECK
 
-#define BOOST_SAFE_FLOAT_POLICY_DO_POST_CHECK(capacity)                                       \
-    static bool post_##capacity##_check(Policy& p, Fp const& value)                           \
-    {                                                                                         \
-        if constexpr (has_post_##capacity##_check()) return p.post_##capacity##_check(value); \
-        return true;                                                                          \
+#define BOOST_SAFE_FLOAT_POLICY_DO_POST_CHECK(capacity)                                                      \
+    static constexpr bool post_##capacity##_check(Policy& p, Fp const& lhs, Fp const& rhs, Fp const& result) \
+    {                                                                                                        \
+        if constexpr (has_post_##capacity##_check()) return p.post_##capacity##_check(lhs, rhs, result);     \
+        return true;                                                                                         \
     }
 
     BOOST_SAFE_FLOAT_POLICY_DO_POST_CHECK(addition)
@@ -98,14 +299,22 @@ public:
 
 #undef BOOST_SAFE_FLOAT_POLICY_DO_POST_CHECK
 
-#define BOOST_SAFE_FLOAT_POLICY_REPORT_PRE_CHECK_ERROR(operation)                                        \
-    template<typename ERROR_HANDLING>                                                                    \
-    static void report_pre_##operation(Policy& p, Fp const& lhs, Fp const& rhs, ERROR_HANDLING& e)       \
-    {                                                                                                    \
-        if constexpr (has_pre_##operation##_check())                                                     \
-        {                                                                                                \
-            if (!p.pre_##operation##_check(lhs, rhs)) e.report_failure(p.operation##_failure_message()); \
-        }                                                                                                \
+#define BOOST_SAFE_FLOAT_POLICY_REPORT_PRE_CHECK_ERROR(operation)                                              \
+    template<typename ERROR_HANDLING>                                                                          \
+    static constexpr void report_pre_##operation(Policy& p, Fp const& lhs, Fp const& rhs, ERROR_HANDLING& e)   \
+    {                                                                                                          \
+        if constexpr (has_pre_##operation##_check())                                                           \
+        {                                                                                                      \
+            if (!p.pre_##operation##_check(lhs, rhs))                                                          \
+            {                                                                                                  \
+                failure<Fp> const f{operation_kind::operation, operation##_failed_category(p, lhs, rhs, Fp{}), \
+                                    false, lhs, rhs, Fp{}};                                                    \
+                if (is_constant_evaluated())                                                                   \
+                    helper::check_failed_during_constant_evaluation(f);                                        \
+                else                                                                                           \
+                    helper::report_failure(e, f, [&] { return operation##_failure_message(p, f); });           \
+            }                                                                                                  \
+        }                                                                                                      \
     }
 
     BOOST_SAFE_FLOAT_POLICY_REPORT_PRE_CHECK_ERROR(addition)
@@ -115,14 +324,23 @@ public:
 
 #undef BOOST_SAFE_FLOAT_POLICY_REPORT_PRE_CHECK_ERROR
 
-#define BOOST_SAFE_FLOAT_POLICY_REPORT_POST_CHECK_ERROR(operation)                                     \
-    template<typename ERROR_HANDLING>                                                                  \
-    static void report_post_##operation(Policy& p, Fp const& value, ERROR_HANDLING& e)                 \
-    {                                                                                                  \
-        if constexpr (has_post_##operation##_check())                                                  \
-        {                                                                                              \
-            if (!p.post_##operation##_check(value)) e.report_failure(p.operation##_failure_message()); \
-        }                                                                                              \
+#define BOOST_SAFE_FLOAT_POLICY_REPORT_POST_CHECK_ERROR(operation)                                             \
+    template<typename ERROR_HANDLING>                                                                          \
+    static constexpr void report_post_##operation(Policy& p, Fp const& lhs, Fp const& rhs, Fp const& result,   \
+                                                  ERROR_HANDLING& e)                                           \
+    {                                                                                                          \
+        if constexpr (has_post_##operation##_check())                                                          \
+        {                                                                                                      \
+            if (!p.post_##operation##_check(lhs, rhs, result))                                                 \
+            {                                                                                                  \
+                failure<Fp> const f{operation_kind::operation,                                                 \
+                                    operation##_failed_category(p, lhs, rhs, result), true, lhs, rhs, result}; \
+                if (is_constant_evaluated())                                                                   \
+                    helper::check_failed_during_constant_evaluation(f);                                        \
+                else                                                                                           \
+                    helper::report_failure(e, f, [&] { return operation##_failure_message(p, f); });           \
+            }                                                                                                  \
+        }                                                                                                      \
     }
 
     BOOST_SAFE_FLOAT_POLICY_REPORT_POST_CHECK_ERROR(addition)
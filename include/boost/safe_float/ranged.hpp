@@ -0,0 +1,388 @@
+#ifndef BOOST_SAFE_FLOAT_RANGED_HPP
+#define BOOST_SAFE_FLOAT_RANGED_HPP
+
+#include <limits>
+#include <string>
+#include <type_traits>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/policy/policy_composers.hpp>
+
+// This file defines ranged_safe_float<FP, LO, HI, CHECK, ERROR_HANDLING>, a FP known to be in [LO, HI].
+// The operators compute the range of their result at compile time and instantiate only the sub-policies of CHECK
+// detecting a failure the operand ranges can reach: an overflow check is dropped when the result range is finite, an
+// underflow check when it stays away from the subnormals, the invalid result and division by zero checks when the
+// divisor range doesn't contain 0. The inexact checks and the policies without a failure_category are always kept.
+// The bounds are computed with the rounding of the operations: the rounding to nearest is monotonic, the rounded
+// results of operands in their ranges are between the rounded results of the bounds. The ranges are then exact for the
+// default rounding mode only.
+// The bounds are template parameters of type FP, this needs the floating point non-type template parameters of C++20.
+
+#if __cpp_nontype_template_args >= 201911L
+
+namespace boost
+{
+namespace safe_float
+{
+namespace range
+{
+// The failures an operation can give for operands in their ranges
+struct reachable_failures
+{
+    bool overflow = true;
+    bool underflow = true;
+    bool invalid_result = true;
+    bool division_by_zero = true;
+};
+
+// Range of the result of an operation and the failures it can reach
+template<class FP>
+struct bounds
+{
+    FP lo;
+    FP hi;
+    reachable_failures failures;
+};
+
+namespace detail
+{
+template<class FP>
+constexpr FP abs(FP x)
+{
+    return x < 0 ? -x : x;
+}
+
+// -0 and 0 are different template arguments
+template<class FP>
+constexpr FP normalized(FP x)
+{
+    return x == 0 ? FP(0) : x;
+}
+
+template<class FP>
+constexpr bool is_finite(FP lo, FP hi)
+{
+    return std::numeric_limits<FP>::lowest() <= lo && hi <= std::numeric_limits<FP>::max();
+}
+
+// The overflow thresholds are computed with a margin of 2 epsilon for their own rounding
+template<class FP>
+constexpr FP margin(FP threshold)
+{
+    return threshold * (1 - 2 * std::numeric_limits<FP>::epsilon());
+}
+
+// The bound computations overflowing are not constant expressions, a result which may overflow is infinite instead
+template<class FP>
+constexpr FP overflowed(bool negative)
+{
+    return negative ? -std::numeric_limits<FP>::infinity() : std::numeric_limits<FP>::infinity();
+}
+
+template<class FP>
+constexpr FP sum(FP a, FP b)
+{
+    if ((a < 0) == (b < 0) && abs(a) >= margin(std::numeric_limits<FP>::max() - abs(b))) return overflowed<FP>(a < 0);
+    return a + b;
+}
+
+template<class FP>
+constexpr FP product(FP a, FP b)
+{
+    if (abs(b) > 1 && abs(a) >= margin(std::numeric_limits<FP>::max() / abs(b)))
+        return overflowed<FP>((a < 0) != (b < 0));
+    return a * b;
+}
+
+// b is not 0
+template<class FP>
+constexpr FP quotient(FP a, FP b)
+{
+    if (abs(b) < 1 && abs(a) >= margin(std::numeric_limits<FP>::max() * abs(b)))
+        return overflowed<FP>((a < 0) != (b < 0));
+    return a / b;
+}
+
+template<class FP>
+constexpr FP min(FP a, FP b, FP c, FP d)
+{
+    FP const ab = a < b ? a : b;
+    FP const cd = c < d ? c : d;
+    return ab < cd ? ab : cd;
+}
+
+template<class FP>
+constexpr FP max(FP a, FP b, FP c, FP d)
+{
+    FP const ab = a < b ? b : a;
+    FP const cd = c < d ? d : c;
+    return ab < cd ? cd : ab;
+}
+
+// Result range of an operation on finite ranges: infinite bounds mean an overflow is reachable, a range reaching
+// (-min(), min()) has subnormal or rounded to 0 results
+template<class FP>
+constexpr bounds<FP> finite_operation_bounds(FP lo, FP hi, bool invalid_result, bool division_by_zero)
+{
+    bool const overflow = !is_finite(lo, hi);
+    bool const underflow = lo < std::numeric_limits<FP>::min() && hi > -std::numeric_limits<FP>::min();
+    return {normalized(lo), normalized(hi), {overflow, underflow, invalid_result, division_by_zero}};
+}
+
+template<class FP>
+constexpr bounds<FP> unbounded()
+{
+    return {-std::numeric_limits<FP>::infinity(), std::numeric_limits<FP>::infinity(), {}};
+}
+} // namespace detail
+
+// The operations on ranges with an infinite bound give an unbounded range and keep every check
+template<class FP>
+constexpr bounds<FP> addition(FP lo1, FP hi1, FP lo2, FP hi2)
+{
+    if (!detail::is_finite(lo1, hi1) || !detail::is_finite(lo2, hi2)) return detail::unbounded<FP>();
+    return detail::finite_operation_bounds(detail::sum(lo1, lo2), detail::sum(hi1, hi2), false, false);
+}
+
+template<class FP>
+constexpr bounds<FP> subtraction(FP lo1, FP hi1, FP lo2, FP hi2)
+{
+    return addition(lo1, hi1, -hi2, -lo2);
+}
+
+template<class FP>
+constexpr bounds<FP> multiplication(FP lo1, FP hi1, FP lo2, FP hi2)
+{
+    if (!detail::is_finite(lo1, hi1) || !detail::is_finite(lo2, hi2)) return detail::unbounded<FP>();
+    FP const products[] = {detail::product(lo1, lo2), detail::product(lo1, hi2), detail::product(hi1, lo2),
+                           detail::product(hi1, hi2)};
+    return detail::finite_operation_bounds(detail::min(products[0], products[1], products[2], products[3]),
+                                           detail::max(products[0], products[1], products[2], products[3]), false,
+                                           false);
+}
+
+// A divisor range containing 0 gives an unbounded range, 0 / 0 is reachable when the dividend range contains 0 too
+template<class FP>
+constexpr bounds<FP> division(FP lo1, FP hi1, FP lo2, FP hi2)
+{
+    if (!detail::is_finite(lo1, hi1) || !detail::is_finite(lo2, hi2)) return detail::unbounded<FP>();
+    if (lo2 <= 0 && 0 <= hi2)
+        return {-std::numeric_limits<FP>::infinity(), std::numeric_limits<FP>::infinity(),
+                {true, true, lo1 <= 0 && 0 <= hi1, true}};
+    FP const quotients[] = {detail::quotient(lo1, lo2), detail::quotient(lo1, hi2), detail::quotient(hi1, lo2),
+                            detail::quotient(hi1, hi2)};
+    return detail::finite_operation_bounds(detail::min(quotients[0], quotients[1], quotients[2], quotients[3]),
+                                           detail::max(quotients[0], quotients[1], quotients[2], quotients[3]), false,
+                                           false);
+}
+
+constexpr bool is_reachable(policy::failure_category category, reachable_failures failures)
+{
+    switch (category)
+    {
+        case policy::failure_category::overflow: return failures.overflow;
+        case policy::failure_category::underflow: return failures.underflow;
+        case policy::failure_category::invalid_result: return failures.invalid_result;
+        case policy::failure_category::division_by_zero: return failures.division_by_zero;
+        default: return true;
+    }
+}
+
+namespace detail
+{
+// The sub-policies of a check policy, a policy not composed is its only sub-policy
+template<class FLAT, template<class> class CHECK>
+struct sub_policies
+{
+    using type = policy::flattened<CHECK>;
+};
+
+template<template<class> class... As, template<class> class CHECK>
+struct sub_policies<policy::flattened<As...>, CHECK>
+{
+    using type = policy::flattened<As...>;
+};
+
+template<class FP, class FLAT>
+struct composed;
+
+template<class FP, template<class> class... As>
+struct composed<FP, policy::flattened<As...>>
+{
+    using type = policy::composed_check<FP, As...>;
+};
+} // namespace detail
+
+// The sub-policies of CHECK detecting a failure reachable by the operation, composed in a check policy
+#define BOOST_SAFE_FLOAT_RANGED_CHECKS(operation)                                                                   \
+    template<class FP, template<class> class CHECK, reachable_failures FAILURES>                                    \
+    struct operation##_checks                                                                                       \
+    {                                                                                                               \
+        template<class KEPT, template<class> class... As>                                                           \
+        struct filter                                                                                               \
+        {                                                                                                           \
+            using type = KEPT;                                                                                      \
+        };                                                                                                          \
+                                                                                                                    \
+        template<template<class> class... KEPT, template<class> class FIRST, template<class> class... REST>         \
+        struct filter<policy::flattened<KEPT...>, FIRST, REST...>                                                   \
+        {                                                                                                           \
+            using type = typename filter<                                                                           \
+                std::conditional_t<is_reachable(policy::policy_traits<FP, FIRST<FP>>::operation##_failure_category(), \
+                                                FAILURES),                                                          \
+                                   policy::flattened<KEPT..., FIRST>, policy::flattened<KEPT...>>,                  \
+                REST...>::type;                                                                                     \
+        };                                                                                                          \
+                                                                                                                    \
+        template<class FLAT>                                                                                        \
+        struct filter_flat;                                                                                         \
+                                                                                                                    \
+        template<template<class> class... As>                                                                       \
+        struct filter_flat<policy::flattened<As...>>                                                                \
+        {                                                                                                           \
+            using type = typename filter<policy::flattened<>, As...>::type;                                         \
+        };                                                                                                          \
+                                                                                                                    \
+        using flat = typename detail::sub_policies<                                                                 \
+            typename policy::flattener<policy::composed_check>::template flatten_composed<CHECK<FP>>::type,         \
+            CHECK>::type;                                                                                           \
+        using type = typename detail::composed<FP, typename filter_flat<flat>::type>::type;                         \
+    };
+
+BOOST_SAFE_FLOAT_RANGED_CHECKS(addition)
+BOOST_SAFE_FLOAT_RANGED_CHECKS(subtraction)
+BOOST_SAFE_FLOAT_RANGED_CHECKS(multiplication)
+BOOST_SAFE_FLOAT_RANGED_CHECKS(division)
+
+#undef BOOST_SAFE_FLOAT_RANGED_CHECKS
+} // namespace range
+
+/**
+ * FP value in [LO, HI], the bounds can be infinite. The constructors from FP and from the ranged_safe_float with a
+ * wider range check the value is in the range and report to ERROR_HANDLING when it isn't, the ranged_safe_float with a
+ * narrower range convert implicitly.
+ */
+template<class FP, FP LO, FP HI, template<class T> class CHECK = policy::check_all,
+         class ERROR_HANDLING = policy::on_fail_throw>
+class ranged_safe_float : private ERROR_HANDLING
+{
+    static_assert(std::is_floating_point<FP>::value,
+                  "First template parameter in ranged_safe_float has to be floating point data type");
+    static_assert(LO <= HI, "The range of a ranged_safe_float can't be empty");
+
+    template<class OTHER_FP, OTHER_FP, OTHER_FP, template<class> class, class>
+    friend class ranged_safe_float;
+
+    FP number;
+
+    ERROR_HANDLING& handler() noexcept { return static_cast<ERROR_HANDLING&>(*this); }
+
+    struct unchecked
+    {};
+    ranged_safe_float(unchecked, FP f, const ERROR_HANDLING& e) : ERROR_HANDLING(e), number{f} {}
+
+    template<FP OTHER_LO, FP OTHER_HI>
+    static constexpr bool contains = LO <= OTHER_LO && OTHER_HI <= HI;
+
+    void check_range()
+    {
+        if (!(LO <= number && number <= HI))
+            handler().report_failure(std::string("Value out of the range of the ranged_safe_float"));
+    }
+
+public:
+    using value_type = FP;
+    static constexpr FP lower_bound = LO;
+    static constexpr FP upper_bound = HI;
+
+    ranged_safe_float() : number{LO <= 0 && 0 <= HI ? FP(0) : LO} {}
+
+    explicit ranged_safe_float(FP f) : number{f} { check_range(); }
+
+    template<FP OTHER_LO, FP OTHER_HI, std::enable_if_t<contains<OTHER_LO, OTHER_HI>, int> = 0>
+    ranged_safe_float(const ranged_safe_float<FP, OTHER_LO, OTHER_HI, CHECK, ERROR_HANDLING>& other) :
+        ERROR_HANDLING(other), number{other.number}
+    {}
+
+    template<FP OTHER_LO, FP OTHER_HI, std::enable_if_t<!contains<OTHER_LO, OTHER_HI>, int> = 0>
+    explicit ranged_safe_float(const ranged_safe_float<FP, OTHER_LO, OTHER_HI, CHECK, ERROR_HANDLING>& other) :
+        ERROR_HANDLING(other), number{other.number}
+    {
+        check_range();
+    }
+
+    FP get_stored_value() const { return number; }
+
+    // unary negative operator
+    auto operator-() const
+    {
+        using result_type = ranged_safe_float<FP, range::detail::normalized(-HI), range::detail::normalized(-LO), CHECK,
+                                              ERROR_HANDLING>;
+        return result_type(typename result_type::unchecked{}, -number, *this);
+    }
+
+    // binary arithmetic operators, the result has the range computed by range::<operation>. The operation is a member
+    // function, the friends of a class are not friends of its friends.
+#define BOOST_SAFE_FLOAT_RANGED_OPERATOR(OP, operation)                                                     \
+    template<FP OTHER_LO, FP OTHER_HI>                                                                     \
+    auto operation(const ranged_safe_float<FP, OTHER_LO, OTHER_HI, CHECK, ERROR_HANDLING>& rhs) const      \
+    {                                                                                                      \
+        constexpr range::bounds<FP> result_range = range::operation<FP>(LO, HI, OTHER_LO, OTHER_HI);       \
+        using checks = typename range::operation##_checks<FP, CHECK, result_range.failures>::type;        \
+        using result_type = ranged_safe_float<FP, result_range.lo, result_range.hi, CHECK, ERROR_HANDLING>; \
+        FP l = number, r = rhs.number;                                                                     \
+        if constexpr (std::is_same_v<checks, policy::composed_check<FP>>)                                  \
+            return result_type(typename result_type::unchecked{}, l OP r, *this);                          \
+        else                                                                                               \
+        {                                                                                                  \
+            using traits = policy::policy_traits<FP, checks>;                                              \
+            checks p{};                                                                                    \
+            result_type result(typename result_type::unchecked{}, FP{}, *this);                            \
+            traits::report_pre_##operation(p, l, r, result.handler());                                     \
+            policy::fenv_flags::fence<FP>(l, r);                                                           \
+            result.number = l OP r;                                                                        \
+            policy::fenv_flags::fence<FP>(result.number);                                                  \
+            traits::report_post_##operation(p, l, r, result.number, result.handler());                     \
+            return result;                                                                                 \
+        }                                                                                                  \
+    }                                                                                                      \
+                                                                                                           \
+    template<FP OTHER_LO, FP OTHER_HI>                                                                     \
+    friend auto operator OP(const ranged_safe_float& lhs,                                                  \
+                            const ranged_safe_float<FP, OTHER_LO, OTHER_HI, CHECK, ERROR_HANDLING>& rhs)   \
+    {                                                                                                      \
+        return lhs.operation(rhs);                                                                         \
+    }
+
+    BOOST_SAFE_FLOAT_RANGED_OPERATOR(+, addition)
+    BOOST_SAFE_FLOAT_RANGED_OPERATOR(-, subtraction)
+    BOOST_SAFE_FLOAT_RANGED_OPERATOR(*, multiplication)
+    BOOST_SAFE_FLOAT_RANGED_OPERATOR(/, division)
+
+#undef BOOST_SAFE_FLOAT_RANGED_OPERATOR
+};
+
+// comparison operators
+#define BOOST_SAFE_FLOAT_RANGED_COMPARISON(OP)                                                                      \
+    template<class FP, FP LO, FP HI, FP OTHER_LO, FP OTHER_HI, template<class T> class CHECK, class ERROR_HANDLING> \
+    inline bool operator OP(const ranged_safe_float<FP, LO, HI, CHECK, ERROR_HANDLING>& lhs,                        \
+                            const ranged_safe_float<FP, OTHER_LO, OTHER_HI, CHECK, ERROR_HANDLING>& rhs)            \
+    {                                                                                                               \
+        return lhs.get_stored_value() OP rhs.get_stored_value();                                                    \
+    }
+
+BOOST_SAFE_FLOAT_RANGED_COMPARISON(<)
+BOOST_SAFE_FLOAT_RANGED_COMPARISON(>)
+BOOST_SAFE_FLOAT_RANGED_COMPARISON(<=)
+BOOST_SAFE_FLOAT_RANGED_COMPARISON(>=)
+BOOST_SAFE_FLOAT_RANGED_COMPARISON(==)
+BOOST_SAFE_FLOAT_RANGED_COMPARISON(!=)
+
+#undef BOOST_SAFE_FLOAT_RANGED_COMPARISON
+
+} // namespace safe_float
+} // namespace boost
+
+#endif // __cpp_nontype_template_args >= 201911L
+
+#endif // BOOST_SAFE_FLOAT_RANGED_HPP
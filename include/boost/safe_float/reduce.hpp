@@ -0,0 +1,340 @@
+#ifndef BOOST_SAFE_FLOAT_REDUCE_HPP
+#define BOOST_SAFE_FLOAT_REDUCE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/batch.hpp>
+#include <boost/safe_float/policy/fused_checker.hpp>
+
+// This file defines the reduction of ranges of safe_float by several threads.
+// The range is split in chunks of a fixed size, reduced by the threads in any order and combined in the order of the
+// chunks by the calling thread: the result depends on the chunk size, not on the number of threads. The sums and the
+// products are computed on the FP values with the checks of the batch operations, the FE_* flags being per thread:
+// they are cleared before a chunk and tested after it by the thread reducing it. Only a failed chunk is replayed with
+// the scalar checks, its first failure is kept as a record (chunk, index, category, message). The records are given to
+// the handler once every chunk is reduced, in the order of the chunks.
+
+namespace boost
+{
+namespace safe_float
+{
+namespace reduction
+{
+struct options
+{
+    // threads reducing the chunks, 0 for std::thread::hardware_concurrency()
+    unsigned threads = 0;
+    // values reduced by a thread at once, the partial results are combined in the order of the chunks
+    std::size_t chunk_size = std::size_t(1) << 15;
+};
+
+// The first failure of a chunk, or of the combination of its partial result
+struct failure_record
+{
+    std::size_t chunk;
+    // index of the value failing, from first, or of the first value of the chunk when combining its partial result or
+    // the partial results of its lanes fails
+    std::size_t index;
+    // unknown for the failures of other operations than the sums and the products
+    policy::failure_category category;
+    std::string message;
+};
+
+// Operations giving the smallest and the largest value, they don't round and never fail
+struct minimum
+{
+    template<class T>
+    constexpr T operator()(const T& lhs, const T& rhs) const
+    {
+        return rhs < lhs ? rhs : lhs;
+    }
+};
+
+struct maximum
+{
+    template<class T>
+    constexpr T operator()(const T& lhs, const T& rhs) const
+    {
+        return lhs < rhs ? rhs : lhs;
+    }
+};
+
+namespace detail
+{
+template<typename ERROR_HANDLING, typename = std::void_t<>>
+struct has_report_reduce_failure : std::false_type
+{};
+
+template<typename ERROR_HANDLING>
+struct has_report_reduce_failure<ERROR_HANDLING,
+                                 std::void_t<decltype(std::declval<ERROR_HANDLING&>().report_reduce_failure(
+                                     std::declval<const failure_record&>()))>> : std::true_type
+{};
+
+template<typename ERROR_HANDLING>
+void report_reduce_failure(ERROR_HANDLING& handler, const failure_record& record)
+{
+    if constexpr (has_report_reduce_failure<ERROR_HANDLING>::value)
+        handler.report_reduce_failure(record);
+    else
+        batch::detail::report_batch_failure(handler, record.message, record.index);
+}
+
+enum class reduction_kind
+{
+    sum,
+    product,
+    minimum,
+    maximum,
+    other
+};
+
+template<class OP, class SF>
+constexpr reduction_kind kind_of()
+{
+    if constexpr (std::is_same<OP, std::plus<>>::value || std::is_same<OP, std::plus<SF>>::value)
+        return reduction_kind::sum;
+    else if constexpr (std::is_same<OP, std::multiplies<>>::value || std::is_same<OP, std::multiplies<SF>>::value)
+        return reduction_kind::product;
+    else if constexpr (std::is_same<OP, minimum>::value)
+        return reduction_kind::minimum;
+    else if constexpr (std::is_same<OP, maximum>::value)
+        return reduction_kind::maximum;
+    else
+        return reduction_kind::other;
+}
+
+// Handler used while replaying a chunk to keep its first failure with its category
+template<class FP>
+struct capture_record
+{
+    bool failed = false;
+    policy::failure_category category = policy::failure_category::unknown;
+    std::string message;
+
+    void report_failure(const policy::failure<FP>& f)
+    {
+        if (!failed)
+        {
+            category = f.category;
+            message = f.message();
+        }
+        failed = true;
+    }
+
+    void report_failure(const std::string& s)
+    {
+        if (!failed) message = s;
+        failed = true;
+    }
+};
+
+// Reduces the values [first, last) of a chunk with step(lhs, rhs, index), the chunks long enough are reduced in
+// several lanes to overlap the latencies of the operations. The replay of a failed chunk calls step in the same order.
+template<class FP, class IT, class STEP>
+FP reduce_values(IT values, std::size_t first, std::size_t last, STEP&& step)
+{
+    constexpr std::size_t lanes = 8;
+    FP partial[lanes];
+    std::size_t i = first;
+    if (last - first >= 2 * lanes)
+    {
+        for (std::size_t l = 0; l < lanes; ++l) partial[l] = values[first + l].get_stored_value();
+        for (i = first + lanes; i + lanes <= last; i += lanes)
+            for (std::size_t l = 0; l < lanes; ++l)
+                partial[l] = step(partial[l], values[i + l].get_stored_value(), i + l);
+        for (std::size_t width = lanes / 2; width > 0; width /= 2)
+            for (std::size_t l = 0; l < width; ++l) partial[l] = step(partial[l], partial[l + width], first);
+    }
+    else
+        partial[0] = values[i++].get_stored_value();
+    for (; i < last; ++i) partial[0] = step(partial[0], values[i].get_stored_value(), i);
+    return partial[0];
+}
+
+#define BOOST_SAFE_FLOAT_REDUCE_OPERATION(operation, OP)                                                          \
+    /* partial result of the chunk [first, last), its first failure is kept in record */                          \
+    template<class SF, class IT>                                                                                  \
+    typename SF::value_type reduce_##operation(IT values, std::size_t chunk, std::size_t first, std::size_t last, \
+                                               failure_record& record)                                            \
+    {                                                                                                             \
+        using FP = typename SF::value_type;                                                                       \
+        using POLICY = typename SF::check_policy;                                                                 \
+        using checker = policy::fused_checker<FP, POLICY>;                                                        \
+        constexpr int flags = checker::operation##_fenv_flags;                                                    \
+                                                                                                                  \
+        if constexpr (flags != 0) policy::fenv_flags::clear<FP>(flags);                                           \
+        bool ok = true;                                                                                           \
+        FP const result = reduce_values<FP>(values, first, last, [&ok](FP lhs, FP rhs, std::size_t) {             \
+            FP const r = lhs OP rhs;                                                                              \
+            ok &= checker::operation##_check(lhs, rhs, r);                                                        \
+            return r;                                                                                             \
+        });                                                                                                       \
+        if constexpr (flags != 0) ok &= !policy::fenv_flags::test<FP>(flags);                                     \
+        if (ok) return result;                                                                                    \
+                                                                                                                  \
+        /* rare path: replay the chunk with the scalar checks to find its first failure */                        \
+        POLICY p{};                                                                                               \
+        return reduce_values<FP>(values, first, last, [&](FP lhs, FP rhs, std::size_t index) {                    \
+            capture_record<FP> capture;                                                                           \
+            FP const r = policy::detail::checked_##operation(p, lhs, rhs, capture);                               \
+            if (capture.failed && record.message.empty())                                                         \
+                record = failure_record{chunk, index, capture.category, std::move(capture.message)};              \
+            return r;                                                                                             \
+        });                                                                                                       \
+    }                                                                                                             \
+                                                                                                                  \
+    /* lhs OP rhs checked by the policy of SF, a failure is kept in record */                                     \
+    template<class SF>                                                                                            \
+    typename SF::value_type combine_##operation(typename SF::value_type lhs, typename SF::value_type rhs,         \
+                                                std::size_t chunk, std::size_t index, failure_record& record)     \
+    {                                                                                                             \
+        using FP = typename SF::value_type;                                                                       \
+        typename SF::check_policy p{};                                                                            \
+        capture_record<FP> capture;                                                                               \
+        FP const r = policy::detail::checked_##operation(p, lhs, rhs, capture);                                   \
+        if (capture.failed) record = failure_record{chunk, index, capture.category, std::move(capture.message)};  \
+        return r;                                                                                                 \
+    }
+
+BOOST_SAFE_FLOAT_REDUCE_OPERATION(addition, +)
+BOOST_SAFE_FLOAT_REDUCE_OPERATION(multiplication, *)
+
+#undef BOOST_SAFE_FLOAT_REDUCE_OPERATION
+
+// Runs work(chunk) for every chunk on the calling thread and threads - 1 other ones
+template<class WORK>
+void for_each_chunk(std::size_t chunks, unsigned threads, WORK&& work)
+{
+    std::atomic<std::size_t> next{0};
+    auto const worker = [&] {
+        for (std::size_t chunk = next++; chunk < chunks; chunk = next++) work(chunk);
+    };
+    std::vector<std::thread> workers;
+    for (unsigned i = 1; i < threads; ++i) workers.emplace_back(worker);
+    worker();
+    for (auto& w : workers) w.join();
+}
+} // namespace detail
+} // namespace reduction
+
+// Reduces init and the values of [first, last) with op, in parallel. The sums (std::plus), the products
+// (std::multiplies) and minimum and maximum are computed on the FP values, the sums and the products being checked by
+// the CHECK of SF. A failure is given to the handler with its index, from first, through
+// report_reduce_failure(failure_record) when it provides it, report_batch_failure(message, index) or report_failure
+// otherwise, in the order of the values once every chunk is reduced. A chunk is reduced up to its end after a failure
+// but only its first failure is reported.
+// Other operations are applied to SF values, op being an associative operation callable from several threads. The
+// exceptions they throw are reported the same way, with an unknown category, their chunk being left.
+template<class IT, class OP, class ERROR_HANDLING = typename std::iterator_traits<IT>::value_type::report_policy>
+typename std::iterator_traits<IT>::value_type reduce(IT first, IT last,
+                                                     typename std::iterator_traits<IT>::value_type init, OP op,
+                                                     const reduction::options& opts = reduction::options{},
+                                                     ERROR_HANDLING handler = ERROR_HANDLING{})
+{
+    using SF = typename std::iterator_traits<IT>::value_type;
+    using FP = typename SF::value_type;
+    using reduction::detail::reduction_kind;
+    static_assert(is_safe_float<SF>::value, "The values reduced are safe_float");
+    static_assert(std::is_base_of<std::random_access_iterator_tag,
+                                  typename std::iterator_traits<IT>::iterator_category>::value,
+                  "The values reduced are accessed by random access iterators");
+    constexpr reduction_kind kind = reduction::detail::kind_of<OP, SF>();
+
+    std::size_t const size = std::size_t(last - first);
+    std::size_t const chunk_size = std::max<std::size_t>(1, opts.chunk_size);
+    std::size_t const chunks = (size + chunk_size - 1) / chunk_size;
+    unsigned threads = opts.threads != 0 ? opts.threads : std::max(1u, std::thread::hardware_concurrency());
+    threads = unsigned(std::min<std::size_t>(threads, chunks));
+
+    // partial result and first failure of every chunk, the failures combining a partial result follow its chunk's
+    std::vector<FP> partials(chunks);
+    std::vector<reduction::failure_record> records(2 * chunks);
+    std::vector<std::exception_ptr> exceptions;
+    std::vector<SF> others;
+    if constexpr (kind == reduction_kind::other)
+    {
+        others.resize(chunks);
+        exceptions.resize(chunks);
+    }
+
+    reduction::detail::for_each_chunk(chunks, threads, [&](std::size_t chunk) {
+        std::size_t const begin = chunk * chunk_size;
+        std::size_t const end = std::min(size, begin + chunk_size);
+        auto& record = records[2 * chunk];
+        if constexpr (kind == reduction_kind::sum)
+            partials[chunk] = reduction::detail::reduce_addition<SF>(first, chunk, begin, end, record);
+        else if constexpr (kind == reduction_kind::product)
+            partials[chunk] = reduction::detail::reduce_multiplication<SF>(first, chunk, begin, end, record);
+        else if constexpr (kind == reduction_kind::minimum || kind == reduction_kind::maximum)
+            partials[chunk] = reduction::detail::reduce_values<FP>(
+                first, begin, end, [op](FP lhs, FP rhs, std::size_t) { return op(lhs, rhs); });
+        else
+        {
+            std::size_t i = begin;
+            try
+            {
+                SF partial = first[i];
+                for (++i; i < end; ++i) partial = op(partial, first[i]);
+                others[chunk] = partial;
+            }
+            catch (const std::exception& e)
+            {
+                record = reduction::failure_record{chunk, i, policy::failure_category::unknown, e.what()};
+            }
+            catch (...)
+            {
+                exceptions[chunk] = std::current_exception();
+            }
+        }
+    });
+
+    // combined in the order of the chunks
+    if constexpr (kind == reduction_kind::other)
+    {
+        SF combined = init;
+        for (std::size_t chunk = 0; chunk < chunks; ++chunk)
+        {
+            if (exceptions[chunk]) std::rethrow_exception(exceptions[chunk]);
+            if (!records[2 * chunk].message.empty())
+                reduction::detail::report_reduce_failure(handler, records[2 * chunk]);
+            else
+                combined = op(combined, others[chunk]);
+        }
+        return combined;
+    }
+    else
+    {
+        FP result = init.get_stored_value();
+        for (std::size_t chunk = 0; chunk < chunks; ++chunk)
+        {
+            std::size_t const begin = chunk * chunk_size;
+            auto& record = records[2 * chunk + 1];
+            if constexpr (kind == reduction_kind::sum)
+                result = reduction::detail::combine_addition<SF>(result, partials[chunk], chunk, begin, record);
+            else if constexpr (kind == reduction_kind::product)
+                result = reduction::detail::combine_multiplication<SF>(result, partials[chunk], chunk, begin, record);
+            else
+                result = op(result, partials[chunk]);
+        }
+        for (auto const& record : records)
+            if (!record.message.empty()) reduction::detail::report_reduce_failure(handler, record);
+        return SF(result);
+    }
+}
+
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_REDUCE_HPP
@@ -0,0 +1,519 @@
+#ifndef BOOST_SAFE_FLOAT_SIMD_HPP
+#define BOOST_SAFE_FLOAT_SIMD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/policy/fused_checker.hpp>
+
+// This file defines safe_simd<FP, N, CHECK, ERROR_HANDLING>, N lanes of FP checked by the policies of safe_float.
+// The lanes are stored in a GCC vector extension type, compiled to the SSE2, AVX2 or AVX-512 instructions of the
+// target. FE_* flags are cleared and tested once per vector operation, the software checks of the policies provided
+// by the library are evaluated on the whole vector as lane masks (isinf as an exponent compare, subnormal as
+// exponent == 0 && mantissa != 0, ...), other policies are checked lane by lane. When an operation fails, its lanes
+// are replayed with the scalar checks to find the failing lanes and the message of the first one.
+
+// The vector types wider than the registers of the target are returned in memory, the compiler warns the ABI differs
+// from the one of a target having the registers. The warning is disabled for the functions defined here only, the
+// vectors are passed by reference.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+namespace boost
+{
+namespace safe_float
+{
+// Bit i is set when lane i is concerned
+using lane_mask = std::uint64_t;
+
+namespace simd
+{
+namespace detail
+{
+template<class FP>
+struct lane_bits;
+
+template<>
+struct lane_bits<float>
+{
+    using type = std::int32_t;
+};
+
+template<>
+struct lane_bits<double>
+{
+    using type = std::int64_t;
+};
+
+template<class FP, std::size_t N>
+struct vector
+{
+    typedef FP type __attribute__((vector_size(N * sizeof(FP))));
+    // result of the comparisons of type, -1 in the lanes where it holds and 0 elsewhere
+    typedef typename lane_bits<FP>::type mask __attribute__((vector_size(N * sizeof(FP))));
+};
+
+// Lane classification on the exponent: the sign bit is cleared and the magnitude is compared as FP, without the
+// 64 bits integer comparisons SSE2 doesn't have
+template<class FP, std::size_t N>
+typename vector<FP, N>::type magnitude(const typename vector<FP, N>::type& v)
+{
+    using vec = typename vector<FP, N>::type;
+    using mask = typename vector<FP, N>::mask;
+    mask const sign = (mask)(-vec{});
+    return (vec)((mask)v & ~sign);
+}
+
+// exponent all ones and mantissa == 0
+template<class FP, std::size_t N>
+typename vector<FP, N>::mask is_inf(const typename vector<FP, N>::type& v)
+{
+    return magnitude<FP, N>(v) == std::numeric_limits<FP>::infinity();
+}
+
+// exponent all ones and mantissa != 0
+template<class FP, std::size_t N>
+typename vector<FP, N>::mask is_nan(const typename vector<FP, N>::type& v)
+{
+    return v != v;
+}
+
+// exponent == 0 and mantissa != 0
+template<class FP, std::size_t N>
+typename vector<FP, N>::mask is_subnormal(const typename vector<FP, N>::type& v)
+{
+    auto const m = magnitude<FP, N>(v);
+    return (m < std::numeric_limits<FP>::min()) & (m != 0);
+}
+
+// exponent not all ones
+template<class FP, std::size_t N>
+typename vector<FP, N>::mask is_finite(const typename vector<FP, N>::type& v)
+{
+    return magnitude<FP, N>(v) <= std::numeric_limits<FP>::max();
+}
+
+// rounding error of lhs + rhs rounded to result (TwoSum), as policy::eft::addition_is_exact
+template<class FP, std::size_t N>
+typename vector<FP, N>::type two_sum_error(const typename vector<FP, N>::type& lhs,
+                                           const typename vector<FP, N>::type& rhs,
+                                           const typename vector<FP, N>::type& result)
+{
+    auto const rhs_part = result - lhs;
+    return (lhs - (result - rhs_part)) + (rhs - rhs_part);
+}
+
+template<class FP, std::size_t N>
+bool any_lane(const typename vector<FP, N>::mask& m)
+{
+    std::uint64_t words[sizeof(m) / sizeof(std::uint64_t)];
+    std::memcpy(words, &m, sizeof(m));
+    std::uint64_t any = 0;
+    for (std::uint64_t word : words) any |= word;
+    return any != 0;
+}
+
+// True when check_chunk(lhs, rhs, result) gives a failing lane. The vectors wider than the registers of the target are
+// checked by chunks of a register: the compiler splits the comparisons of wider vectors in scalar ones.
+template<class FP, std::size_t N, class CHECK_CHUNK>
+bool any_failing(const typename vector<FP, N>::type& lhs, const typename vector<FP, N>::type& rhs,
+                 const typename vector<FP, N>::type& result, CHECK_CHUNK check_chunk)
+{
+    constexpr std::size_t register_lanes = policy::fenv_flags::detail::vector_register_size / sizeof(FP);
+    constexpr std::size_t lanes = N < register_lanes ? N : register_lanes;
+    if constexpr (lanes == N)
+        return any_lane<FP, N>(check_chunk(lhs, rhs, result));
+    else
+    {
+        using chunk = typename vector<FP, lanes>::type;
+        bool failing = false;
+        for (std::size_t i = 0; i < N; i += lanes)
+        {
+            chunk l, r, res;
+            std::memcpy(&l, reinterpret_cast<const FP*>(&lhs) + i, sizeof(chunk));
+            std::memcpy(&r, reinterpret_cast<const FP*>(&rhs) + i, sizeof(chunk));
+            std::memcpy(&res, reinterpret_cast<const FP*>(&result) + i, sizeof(chunk));
+            failing |= any_lane<FP, lanes>(check_chunk(l, r, res));
+        }
+        return failing;
+    }
+}
+
+template<class FP, std::size_t N>
+lane_mask to_lane_mask(const typename vector<FP, N>::mask& m)
+{
+    lane_mask lanes = 0;
+    for (std::size_t i = 0; i < N; ++i) lanes |= static_cast<lane_mask>(m[i] != 0) << i;
+    return lanes;
+}
+
+// Failing lanes of the software checks of POLICY, as a vector mask. vectorized is false for the policies without a
+// vector version, they are checked lane by lane.
+template<class FP, std::size_t N, class POLICY>
+struct lane_check
+{
+    static constexpr bool vectorized = false;
+};
+
+template<class FP, std::size_t N>
+struct lane_check_base
+{
+    using vec = typename vector<FP, N>::type;
+    using mask = typename vector<FP, N>::mask;
+    static constexpr bool vectorized = true;
+
+    static mask addition(const vec&, const vec&, const vec&) { return mask{}; }
+    static mask subtraction(const vec&, const vec&, const vec&) { return mask{}; }
+    static mask multiplication(const vec&, const vec&, const vec&) { return mask{}; }
+    static mask division(const vec&, const vec&, const vec&) { return mask{}; }
+};
+
+// The expressions are the negation of the software checks of the policies
+#define BOOST_SAFE_FLOAT_SIMD_LANE_CHECK(POLICY, operation, ...)                 \
+    template<class FP, std::size_t N>                                            \
+    struct lane_check<FP, N, policy::POLICY<FP>> : lane_check_base<FP, N>        \
+    {                                                                            \
+        using typename lane_check_base<FP, N>::vec;                              \
+        using typename lane_check_base<FP, N>::mask;                             \
+        static mask operation(const vec& lhs, const vec& rhs, const vec& result) \
+        {                                                                        \
+            (void)lhs;                                                           \
+            (void)rhs;                                                           \
+            return __VA_ARGS__;                                                  \
+        }                                                                        \
+    };
+
+#define BOOST_SAFE_FLOAT_SIMD_OVERFLOW \
+    ~is_inf<FP, N>(lhs) & ~is_inf<FP, N>(rhs) & is_inf<FP, N>(result)
+
+BOOST_SAFE_FLOAT_SIMD_LANE_CHECK(check_addition_overflow, addition, BOOST_SAFE_FLOAT_SIMD_OVERFLOW)
+BOOST_SAFE_FLOAT_SIMD_LANE_CHECK(check_subtraction_overflow, subtraction, BOOST_SAFE_FLOAT_SIMD_OVERFLOW)
+BOOST_SAFE_FLOAT_SIMD_LANE_CHECK(check_multiplication_overflow, multiplication, BOOST_SAFE_FLOAT_SIMD_OVERFLOW)
+BOOST_SAFE_FLOAT_SIMD_LANE_CHECK(check_division_overflow, division, BOOST_SAFE_FLOAT_SIMD_OVERFLOW)
+
+BOOST_SAFE_FLOAT_SIMD_LANE_CHECK(check_addition_underflow, addition, is_subnormal<FP, N>(result))
+BOOST_SAFE_FLOAT_SIMD_LANE_CHECK(check_subtraction_underflow, subtraction, is_subnormal<FP, N>(result))
+BOOST_SAFE_FLOAT_SIMD_LANE_CHECK(check_multiplication_underflow, multiplication, is_subnormal<FP, N>(result))
+BOOST_SAFE_FLOAT_SIMD_LANE_CHECK(check_division_underflow, division,
+                                 is_subnormal<FP, N>(result) | ((result == 0) & (lhs != 0)))
+
+BOOST_SAFE_FLOAT_SIMD_LANE_CHECK(check_addition_invalid_result, addition, is_nan<FP, N>(result))
+BOOST_SAFE_FLOAT_SIMD_LANE_CHECK(check_subtraction_invalid_result, subtraction, is_nan<FP, N>(result))
+BOOST_SAFE_FLOAT_SIMD_LANE_CHECK(check_multiplication_invalid_result, multiplication, is_nan<FP, N>(result))
+BOOST_SAFE_FLOAT_SIMD_LANE_CHECK(check_division_invalid_result, division, is_nan<FP, N>(result))
+
+BOOST_SAFE_FLOAT_SIMD_LANE_CHECK(check_addition_inexact, addition,
+                                 ~is_nan<FP, N>(result) & ((result - rhs != lhs) | (result - lhs != rhs)))
+BOOST_SAFE_FLOAT_SIMD_LANE_CHECK(check_subtraction_inexact, subtraction,
+                                 ~is_nan<FP, N>(result) & ((result + rhs != lhs) | (lhs - result != rhs)))
+BOOST_SAFE_FLOAT_SIMD_LANE_CHECK(check_multiplication_inexact, multiplication,
+                                 ~is_nan<FP, N>(result) & (result / rhs != lhs))
+BOOST_SAFE_FLOAT_SIMD_LANE_CHECK(check_division_inexact, division, ~is_nan<FP, N>(result) & (result * rhs != lhs))
+
+BOOST_SAFE_FLOAT_SIMD_LANE_CHECK(check_division_by_zero, division, rhs == 0)
+
+BOOST_SAFE_FLOAT_SIMD_LANE_CHECK(check_addition_finite, addition, ~is_finite<FP, N>(result))
+BOOST_SAFE_FLOAT_SIMD_LANE_CHECK(check_subtraction_finite, subtraction, ~is_finite<FP, N>(result))
+BOOST_SAFE_FLOAT_SIMD_LANE_CHECK(check_multiplication_finite, multiplication, ~is_finite<FP, N>(result))
+BOOST_SAFE_FLOAT_SIMD_LANE_CHECK(check_division_finite, division, ~(is_finite<FP, N>(result) & is_finite<FP, N>(rhs)))
+
+#define BOOST_SAFE_FLOAT_SIMD_ROUNDED_OVERFLOW \
+    is_inf<FP, N>(result) & is_finite<FP, N>(lhs) & is_finite<FP, N>(rhs)
+
+BOOST_SAFE_FLOAT_SIMD_LANE_CHECK(check_addition_inexact_eft, addition,
+                                 (is_finite<FP, N>(result) & (two_sum_error<FP, N>(lhs, rhs, result) != 0))
+                                     | (BOOST_SAFE_FLOAT_SIMD_ROUNDED_OVERFLOW))
+BOOST_SAFE_FLOAT_SIMD_LANE_CHECK(check_subtraction_inexact_eft, subtraction,
+                                 (is_finite<FP, N>(result) & (two_sum_error<FP, N>(lhs, -rhs, result) != 0))
+                                     | (BOOST_SAFE_FLOAT_SIMD_ROUNDED_OVERFLOW))
+
+#undef BOOST_SAFE_FLOAT_SIMD_ROUNDED_OVERFLOW
+
+#undef BOOST_SAFE_FLOAT_SIMD_OVERFLOW
+#undef BOOST_SAFE_FLOAT_SIMD_LANE_CHECK
+
+// float products and quotients are exact in double, as in policy::eft. The double ones need a fma per lane.
+template<std::size_t N>
+struct lane_check<float, N, policy::check_multiplication_inexact_eft<float>> : lane_check_base<float, N>
+{
+    using typename lane_check_base<float, N>::vec;
+    using typename lane_check_base<float, N>::mask;
+    using wide = typename vector<double, N>::type;
+    static mask multiplication(const vec& lhs, const vec& rhs, const vec& result)
+    {
+        wide const product = __builtin_convertvector(lhs, wide) * __builtin_convertvector(rhs, wide);
+        auto const rounded = __builtin_convertvector(product != __builtin_convertvector(result, wide), mask);
+        return (is_finite<float, N>(result) & rounded)
+               | (is_inf<float, N>(result) & is_finite<float, N>(lhs) & is_finite<float, N>(rhs));
+    }
+};
+
+template<std::size_t N>
+struct lane_check<float, N, policy::check_division_inexact_eft<float>> : lane_check_base<float, N>
+{
+    using typename lane_check_base<float, N>::vec;
+    using typename lane_check_base<float, N>::mask;
+    using wide = typename vector<double, N>::type;
+    static mask division(const vec& lhs, const vec& rhs, const vec& result)
+    {
+        wide const product = __builtin_convertvector(result, wide) * __builtin_convertvector(rhs, wide);
+        auto const rounded = __builtin_convertvector(product != __builtin_convertvector(lhs, wide), mask);
+        return (is_finite<float, N>(result) & ~is_inf<float, N>(rhs) & rounded)
+               | (is_inf<float, N>(result) & is_finite<float, N>(lhs) & is_finite<float, N>(rhs) & (rhs != 0));
+    }
+};
+
+// Splits a check policy as policy::fused_checker does, the software part giving a vector mask of the failing lanes
+template<class FP, std::size_t N, class POLICY>
+struct simd_checker
+{
+    using vec = typename vector<FP, N>::type;
+    using mask = typename vector<FP, N>::mask;
+    using fused = policy::fused_checker<FP, POLICY>;
+
+#define BOOST_SAFE_FLOAT_SIMD_SINGLE_CHECK(operation)                                   \
+    static constexpr int operation##_fenv_flags = fused::operation##_fenv_flags;        \
+    static mask operation##_failures(const vec& lhs, const vec& rhs, const vec& result) \
+    {                                                                                   \
+        if constexpr (operation##_fenv_flags != 0)                                      \
+            return mask{};                                                              \
+        else if constexpr (lane_check<FP, N, POLICY>::vectorized)                       \
+            return lane_check<FP, N, POLICY>::operation(lhs, rhs, result);              \
+        else                                                                            \
+        {                                                                               \
+            mask failing{};                                                             \
+            for (std::size_t i = 0; i < N; ++i)                                         \
+            {                                                                           \
+                bool const ok = fused::operation##_check(lhs[i], rhs[i], result[i]);    \
+                failing[i] = ok ? 0 : -1;                                               \
+            }                                                                           \
+            return failing;                                                             \
+        }                                                                               \
+    }
+
+    BOOST_SAFE_FLOAT_SIMD_SINGLE_CHECK(addition)
+    BOOST_SAFE_FLOAT_SIMD_SINGLE_CHECK(subtraction)
+    BOOST_SAFE_FLOAT_SIMD_SINGLE_CHECK(multiplication)
+    BOOST_SAFE_FLOAT_SIMD_SINGLE_CHECK(division)
+
+#undef BOOST_SAFE_FLOAT_SIMD_SINGLE_CHECK
+};
+
+template<class FP, std::size_t N, template<typename> typename... As>
+struct simd_checker<FP, N, policy::composed_check<FP, As...>>
+{
+    using vec = typename vector<FP, N>::type;
+    using mask = typename vector<FP, N>::mask;
+
+#define BOOST_SAFE_FLOAT_SIMD_COMPOSED_CHECK(operation)                                              \
+    static constexpr int operation##_fenv_flags =                                                    \
+        (simd_checker<FP, N, As<FP>>::operation##_fenv_flags | ... | 0);                             \
+    static mask operation##_failures(const vec& lhs, const vec& rhs, const vec& result)              \
+    {                                                                                                \
+        return (simd_checker<FP, N, As<FP>>::operation##_failures(lhs, rhs, result) | ... | mask{}); \
+    }
+
+    BOOST_SAFE_FLOAT_SIMD_COMPOSED_CHECK(addition)
+    BOOST_SAFE_FLOAT_SIMD_COMPOSED_CHECK(subtraction)
+    BOOST_SAFE_FLOAT_SIMD_COMPOSED_CHECK(multiplication)
+    BOOST_SAFE_FLOAT_SIMD_COMPOSED_CHECK(division)
+
+#undef BOOST_SAFE_FLOAT_SIMD_COMPOSED_CHECK
+};
+
+template<typename ERROR_HANDLING, typename = std::void_t<>>
+struct has_report_lane_failure : std::false_type
+{};
+
+template<typename ERROR_HANDLING>
+struct has_report_lane_failure<ERROR_HANDLING,
+                               std::void_t<decltype(std::declval<ERROR_HANDLING&>().report_lane_failure(
+                                   std::declval<const std::string&>(), std::declval<lane_mask>()))>> :
+    std::true_type
+{};
+
+template<typename ERROR_HANDLING>
+void report_lane_failure(ERROR_HANDLING& handler, const std::string& message, lane_mask lanes)
+{
+    if constexpr (has_report_lane_failure<ERROR_HANDLING>::value)
+        handler.report_lane_failure(message, lanes);
+    else
+    {
+        std::string described = message + " (lanes";
+        for (std::size_t i = 0; i < 64; ++i)
+            if (lanes & (lane_mask(1) << i)) described += " " + std::to_string(i);
+        handler.report_failure(described + ")");
+    }
+}
+} // namespace detail
+} // namespace simd
+
+/**
+ * N lanes of FP with the operators of safe_float, every lane is checked by CHECK and the failures are reported to
+ * ERROR_HANDLING with the mask of the failing lanes, through report_lane_failure(message, lanes) when the handler
+ * provides it, otherwise appended to the message given to report_failure.
+ */
+template<class FP, std::size_t N, template<class T> class CHECK = policy::check_all,
+         class ERROR_HANDLING = policy::on_fail_throw>
+class safe_simd : private CHECK<FP>, ERROR_HANDLING
+{
+    static_assert(std::is_same<FP, float>::value || std::is_same<FP, double>::value,
+                  "safe_simd lanes have to be float or double");
+    static_assert(N > 0 && N <= 64 && (N & (N - 1)) == 0, "safe_simd has a power of 2 lanes, up to 64");
+
+public:
+    using value_type = FP;
+    using vector_type = typename simd::detail::vector<FP, N>::type;
+    using check_policy = CHECK<FP>;
+    using report_policy = ERROR_HANDLING;
+
+private:
+    vector_type number;
+
+    using pol = CHECK<FP>;
+    using checker = simd::detail::simd_checker<FP, N, pol>;
+    pol& policy() noexcept { return static_cast<pol&>(*this); }
+    ERROR_HANDLING& handler() noexcept { return static_cast<ERROR_HANDLING&>(*this); }
+
+    // rare path: replays the lanes with the scalar checks to report the failing ones, kept out of the operators
+    template<class REPLAY>
+    __attribute__((noinline)) void report_failed_lanes(const vector_type& l, const vector_type& r, REPLAY replay)
+    {
+        lane_mask failing = 0;
+        std::string message;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            policy::detail::capture_failure capture;
+            replay(l[i], r[i], capture);
+            if (!capture.failed) continue;
+            if (failing == 0) message = capture.message;
+            failing |= lane_mask(1) << i;
+        }
+        if (failing != 0) simd::detail::report_lane_failure(handler(), message, failing);
+    }
+
+public:
+    static constexpr std::size_t size() noexcept { return N; }
+
+    safe_simd() : number{} {}
+
+    // Every lane set to value
+    explicit safe_simd(FP value) : number(vector_type{} + value) {}
+
+    explicit safe_simd(const vector_type& lanes) : number(lanes) {}
+
+    // Loads N values, p doesn't need to be aligned
+    static safe_simd load(const FP* p)
+    {
+        safe_simd s;
+        std::memcpy(&s.number, p, sizeof(vector_type));
+        return s;
+    }
+
+    template<template<class T> class CAST>
+    static safe_simd load(const safe_float<FP, CHECK, ERROR_HANDLING, CAST>* p)
+    {
+        require_fp_layout<safe_float<FP, CHECK, ERROR_HANDLING, CAST>>();
+        safe_simd s;
+        std::memcpy(&s.number, static_cast<const void*>(p), sizeof(vector_type));
+        return s;
+    }
+
+    void store(FP* p) const { std::memcpy(p, &number, sizeof(vector_type)); }
+
+    template<template<class T> class CAST>
+    void store(safe_float<FP, CHECK, ERROR_HANDLING, CAST>* p) const
+    {
+        require_fp_layout<safe_float<FP, CHECK, ERROR_HANDLING, CAST>>();
+        std::memcpy(static_cast<void*>(p), &number, sizeof(vector_type));
+    }
+
+    FP operator[](std::size_t lane) const { return number[lane]; }
+
+    // Access to internal representation
+    vector_type get_stored_value() const { return number; }
+    void set_stored_value(const vector_type& lanes) { number = lanes; }
+
+    // unary arithmetic operators implementation, the lanes are left unchanged when the failure reported throws
+#define BOOST_SAFE_FLOAT_SIMD_OPERATOR(OP, operation)                                           \
+    safe_simd& operator OP##=(const safe_simd& rhs)                                             \
+    {                                                                                           \
+        constexpr int flags = checker::operation##_fenv_flags;                                  \
+        vector_type l = number, r = rhs.number;                                                 \
+        if constexpr (flags != 0) policy::fenv_flags::clear<FP>(flags);                         \
+        policy::fenv_flags::fence<FP>(l, r);                                                    \
+        vector_type result = l OP r;                                                            \
+        policy::fenv_flags::fence<FP>(result);                                                  \
+        auto const check_chunk = [](const auto& cl, const auto& cr, const auto& cresult) {      \
+            using chunk_checker = simd::detail::simd_checker<FP, sizeof(cl) / sizeof(FP), pol>; \
+            return chunk_checker::operation##_failures(cl, cr, cresult);                        \
+        };                                                                                      \
+        bool ok = !simd::detail::any_failing<FP, N>(l, r, result, check_chunk);                 \
+        if constexpr (flags != 0) ok &= !policy::fenv_flags::test<FP>(flags);                   \
+        if (!ok)                                                                                \
+            report_failed_lanes(l, r, [this](FP lhs, FP rhs, auto& capture) {                   \
+                policy::detail::checked_##operation(policy(), lhs, rhs, capture);               \
+            });                                                                                 \
+        number = result;                                                                        \
+        return *this;                                                                           \
+    }
+
+    BOOST_SAFE_FLOAT_SIMD_OPERATOR(+, addition)
+    BOOST_SAFE_FLOAT_SIMD_OPERATOR(-, subtraction)
+    BOOST_SAFE_FLOAT_SIMD_OPERATOR(*, multiplication)
+    BOOST_SAFE_FLOAT_SIMD_OPERATOR(/, division)
+
+#undef BOOST_SAFE_FLOAT_SIMD_OPERATOR
+
+    // unary negative operator
+    safe_simd operator-() const { return safe_simd(-number); }
+};
+
+// binary arithmetic operators
+#define BOOST_SAFE_FLOAT_SIMD_BINARY_OPERATOR(OP)                                                                  \
+    template<class FP, std::size_t N, template<class T> class CHECK, class ERROR_HANDLING>                         \
+    inline safe_simd<FP, N, CHECK, ERROR_HANDLING> operator OP(const safe_simd<FP, N, CHECK, ERROR_HANDLING>& lhs, \
+                                                              const safe_simd<FP, N, CHECK, ERROR_HANDLING>& rhs)  \
+    {                                                                                                              \
+        safe_simd<FP, N, CHECK, ERROR_HANDLING> result(lhs);                                                       \
+        result OP##= rhs;                                                                                          \
+        return result;                                                                                             \
+    }
+
+BOOST_SAFE_FLOAT_SIMD_BINARY_OPERATOR(+)
+BOOST_SAFE_FLOAT_SIMD_BINARY_OPERATOR(-)
+BOOST_SAFE_FLOAT_SIMD_BINARY_OPERATOR(*)
+BOOST_SAFE_FLOAT_SIMD_BINARY_OPERATOR(/)
+
+#undef BOOST_SAFE_FLOAT_SIMD_BINARY_OPERATOR
+
+// comparison operators, lane-wise: the result has the bits of the lanes where the comparison holds
+#define BOOST_SAFE_FLOAT_SIMD_COMPARISON(OP)                                                        \
+    template<class FP, std::size_t N, template<class T> class CHECK, class ERROR_HANDLING>          \
+    inline lane_mask operator OP(const safe_simd<FP, N, CHECK, ERROR_HANDLING>& lhs,                \
+                                 const safe_simd<FP, N, CHECK, ERROR_HANDLING>& rhs)                \
+    {                                                                                               \
+        return simd::detail::to_lane_mask<FP, N>(lhs.get_stored_value() OP rhs.get_stored_value()); \
+    }
+
+BOOST_SAFE_FLOAT_SIMD_COMPARISON(<)
+BOOST_SAFE_FLOAT_SIMD_COMPARISON(>)
+BOOST_SAFE_FLOAT_SIMD_COMPARISON(<=)
+BOOST_SAFE_FLOAT_SIMD_COMPARISON(>=)
+BOOST_SAFE_FLOAT_SIMD_COMPARISON(==)
+BOOST_SAFE_FLOAT_SIMD_COMPARISON(!=)
+
+#undef BOOST_SAFE_FLOAT_SIMD_COMPARISON
+
+} // namespace safe_float
+} // namespace boost
+
+#pragma GCC diagnostic pop
+
+#endif // BOOST_SAFE_FLOAT_SIMD_HPP
@@ -0,0 +1,187 @@
+#ifndef BOOST_SAFE_FLOAT_SPARSE_HPP
+#define BOOST_SAFE_FLOAT_SPARSE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/batch.hpp>
+#include <boost/safe_float/linalg.hpp>
+#include <boost/safe_float/reduce.hpp>
+
+// This file defines csr_matrix, a sparse matrix of safe_float stored by compressed rows, and its product by a vector
+// on several threads.
+// The rows are split in blocks of about the same number of nonzeros, computed by the threads in any order. A row is
+// accumulated in the order of its nonzeros, by the lanes of a vector for float and double, the x values being gathered
+// by their columns, then the lanes are summed and the last products added: the result doesn't depend on the blocks or
+// on the threads. The multiply-adds are checked by the CHECK of the safe_float as in linalg.hpp, the FE_* flags of a
+// thread being cleared and tested once per block. Only a failing block is replayed row by row with the scalar checks,
+// its first failure is kept with its row and the first one in the order of the rows is reported once every block is
+// computed.
+
+namespace boost
+{
+namespace safe_float
+{
+namespace sparse
+{
+struct options
+{
+    // threads computing the blocks of rows, 0 for std::thread::hardware_concurrency()
+    unsigned threads = 0;
+    // nonzeros of a block of rows, a block is made of whole rows
+    std::size_t block_nonzeros = std::size_t(1) << 14;
+};
+
+/**
+ * A rows x columns matrix of SF, storing the nonzeros of the row r at [row_offsets[r], row_offsets[r + 1]) of
+ * column_indices and values. The values are an array of SF having the layout of their FP, the kernels compute them as
+ * FP. The column indices of a row don't need to be sorted.
+ */
+template<class SF>
+class csr_matrix
+{
+public:
+    using value_type = SF;
+
+private:
+    std::size_t row_count = 0;
+    std::size_t column_count = 0;
+    std::vector<std::size_t> offsets;
+    std::vector<std::size_t> indices;
+    std::vector<SF> nonzero_values;
+
+public:
+    // A rows x columns matrix without nonzeros
+    csr_matrix(std::size_t rows, std::size_t columns) : row_count(rows), column_count(columns), offsets(rows + 1, 0)
+    {
+        require_fp_layout<SF>();
+    }
+
+    // Throws std::invalid_argument when the offsets and the indices don't describe a rows x columns matrix of
+    // values.size() nonzeros
+    csr_matrix(std::size_t rows, std::size_t columns, std::vector<std::size_t> row_offsets,
+               std::vector<std::size_t> column_indices, std::vector<SF> values) :
+        row_count(rows),
+        column_count(columns),
+        offsets(std::move(row_offsets)),
+        indices(std::move(column_indices)),
+        nonzero_values(std::move(values))
+    {
+        require_fp_layout<SF>();
+        if (offsets.size() != rows + 1 || offsets.front() != 0)
+            throw std::invalid_argument("csr_matrix needs rows + 1 row offsets starting at 0");
+        if (!std::is_sorted(offsets.begin(), offsets.end()))
+            throw std::invalid_argument("csr_matrix row offsets are decreasing");
+        if (offsets.back() != nonzero_values.size() || indices.size() != nonzero_values.size())
+            throw std::invalid_argument("csr_matrix needs a column index per value, up to the last row offset");
+        if (std::any_of(indices.begin(), indices.end(), [columns](std::size_t j) { return j >= columns; }))
+            throw std::invalid_argument("csr_matrix column index out of the columns");
+    }
+
+    std::size_t rows() const noexcept { return row_count; }
+    std::size_t columns() const noexcept { return column_count; }
+    std::size_t nonzeros() const noexcept { return nonzero_values.size(); }
+
+    const std::vector<std::size_t>& row_offsets() const noexcept { return offsets; }
+    const std::vector<std::size_t>& column_indices() const noexcept { return indices; }
+    const std::vector<SF>& values() const noexcept { return nonzero_values; }
+    // the values can be changed in place, not the nonzeros
+    SF* values_data() noexcept { return nonzero_values.data(); }
+};
+
+namespace detail
+{
+// The row of the nonzeros [first, last) times x: the products are accumulated in the lanes of a vector, the x values
+// gathered by their columns, the lanes are summed, then the last products are added. The failures are reported with
+// row.
+template<class FP, class STEP>
+FP row_product(const FP* values, const std::size_t* columns, const FP* x, std::size_t first, std::size_t last,
+               std::size_t row, STEP& step)
+{
+    constexpr std::size_t n = linalg::detail::lanes<FP>;
+    FP sum = 0;
+    std::size_t i = first;
+    if constexpr (linalg::detail::vectorized<FP>)
+        if (last - first >= n)
+        {
+            auto const same = [row](std::size_t) { return row; };
+            linalg::detail::vec<FP> acc{};
+            for (; i + n <= last; i += n)
+            {
+                linalg::detail::vec<FP> gathered;
+                for (std::size_t l = 0; l < n; ++l) gathered[l] = x[columns[i + l]];
+                acc = step.lanes_multiply_add(acc, linalg::detail::load(values + i), gathered, same);
+            }
+            sum = acc[0];
+            for (std::size_t l = 1; l < n; ++l) sum = step.add(sum, acc[l], row);
+        }
+    for (; i < last; ++i) sum = step.multiply_add(sum, values[i], x[columns[i]], row);
+    return sum;
+}
+
+// The first row of the block b, the blocks starting at the rows of the multiples of block_nonzeros
+inline std::size_t block_row(const std::vector<std::size_t>& offsets, std::size_t b, std::size_t block_nonzeros)
+{
+    return std::size_t(std::lower_bound(offsets.begin(), offsets.end() - 1, b * block_nonzeros) - offsets.begin());
+}
+} // namespace detail
+
+// y = A x, x having A.columns() values and y A.rows(), on several threads. y must not overlap x. Every value of y is
+// computed, then the first failure in the order of the rows is given to the handler with its row through
+// report_batch_failure(message, row) when it provides it, otherwise appended to the message given to report_failure.
+template<class SF, class ERROR_HANDLING = typename SF::report_policy>
+void spmv(const csr_matrix<SF>& a, const SF* x, SF* y, const options& opts = options{},
+          ERROR_HANDLING handler = ERROR_HANDLING{})
+{
+    using FP = typename SF::value_type;
+    using POLICY = typename SF::check_policy;
+    const FP* const values = reinterpret_cast<const FP*>(a.values().data());
+    const std::size_t* const columns = a.column_indices().data();
+    const std::vector<std::size_t>& offsets = a.row_offsets();
+    const FP* const xs = reinterpret_cast<const FP*>(x);
+    FP* const ys = reinterpret_cast<FP*>(y);
+
+    std::size_t const block_nonzeros = std::max<std::size_t>(1, opts.block_nonzeros);
+    std::size_t const blocks = std::max<std::size_t>(1, (a.nonzeros() + block_nonzeros - 1) / block_nonzeros);
+    unsigned threads = opts.threads != 0 ? opts.threads : std::max(1u, std::thread::hardware_concurrency());
+    threads = unsigned(std::min<std::size_t>(threads, blocks));
+
+    // first failure of every block
+    std::vector<linalg::detail::failure> failures(blocks);
+    reduction::detail::for_each_chunk(blocks, threads, [&](std::size_t b) {
+        std::size_t const first = detail::block_row(offsets, b, block_nonzeros);
+        std::size_t const last = b + 1 == blocks ? a.rows() : detail::block_row(offsets, b + 1, block_nonzeros);
+        linalg::detail::checking_step<FP, POLICY> step;
+        step.restart();
+        for (std::size_t r = first; r < last; ++r)
+            ys[r] = detail::row_product(values, columns, xs, offsets[r], offsets[r + 1], r, step);
+        if (step.failed())
+        {
+            // rare path: the rows of the block are computed again one by one to find the first failure
+            linalg::detail::replay_step<FP, POLICY> replay;
+            for (std::size_t r = first; r < last && !replay.capture.failed; ++r)
+                detail::row_product(values, columns, xs, offsets[r], offsets[r + 1], r, replay);
+            if (replay.capture.failed)
+                failures[b] = linalg::detail::failure{true, replay.index, replay.capture.message};
+        }
+    });
+
+    for (const linalg::detail::failure& f : failures)
+        if (f.failed)
+        {
+            batch::detail::report_batch_failure(handler, f.message, f.index);
+            return;
+        }
+}
+
+} // namespace sparse
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_SPARSE_HPP
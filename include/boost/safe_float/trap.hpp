@@ -0,0 +1,261 @@
+#ifndef BOOST_SAFE_FLOAT_TRAP_HPP
+#define BOOST_SAFE_FLOAT_TRAP_HPP
+
+#include <csignal>
+#include <exception>
+#include <mutex>
+#include <string>
+
+#include <fenv.h>
+
+#include <boost/safe_float/fp_traits.hpp>
+#include <boost/safe_float/policy/check_base_policy.hpp>
+#include <boost/safe_float/policy/on_fail_throw.hpp>
+
+#if defined(__linux__) && defined(__x86_64__) && defined(__GLIBC__)
+#    include <ucontext.h>
+#    define BOOST_SAFE_FLOAT_HAS_FPE_TRAPS
+#endif
+
+// This file defines checking by hardware traps: inside a trap_scope the floating point unit raises SIGFPE on the
+// exceptions selected, so the operators of a safe_float using policy::trapped do no check at all on success.
+//
+// Throwing from a signal handler isn't safe, so the SIGFPE handler records the exception and masks it in the
+// interrupted context: the faulting instruction is restarted and gives its IEEE default result, the other exceptions
+// keep trapping. The failure is reported through the ERROR_HANDLING policy when the scope is left or when check() is
+// called.
+// Only the SSE unit traps. The x87 unit computing long double on x86 delivers its traps on the next floating point
+// instruction, restarting that one would leave the x87 stack unbalanced, so the long double operations raise the x87
+// sticky flags instead, tested with the exceptions trapped.
+// As for the FE_* flags, the compiler doesn't know the scope boundaries order the floating point operations: when
+// optimizing, operations on values not observed inside the scope may be moved out of it.
+// The SIGFPE action is process wide: it is replaced when the first scope of the process is entered and restored when
+// the last one is left, whatever their threads. Signals not coming from a thread inside a scope are forwarded to the
+// action replaced.
+// Where traps are not available (BOOST_SAFE_FLOAT_HAS_FPE_TRAPS undefined) the scope falls back on the sticky
+// FE_* flags, cleared when entering the scope and tested when leaving it.
+
+namespace boost
+{
+namespace safe_float
+{
+namespace policy
+{
+// Check policy for safe_float values used inside a trap_scope, it does nothing in the operators
+template<int EXCEPTIONS = FE_OVERFLOW | FE_DIVBYZERO | FE_INVALID>
+struct trapped
+{
+    template<class FP>
+    class policy : public check_policy<FP>
+    {
+        static_assert(fp_traits<FP>::raises_fenv_flags,
+                      "The trapped values are computed by operations raising the floating point exceptions");
+
+    public:
+        static constexpr int trapped_exceptions = EXCEPTIONS;
+    };
+};
+
+} // namespace policy
+
+namespace detail
+{
+// Exceptions recorded by the SIGFPE handler for the innermost trap_scope of the thread
+inline thread_local volatile std::sig_atomic_t trapped_exceptions = 0;
+inline thread_local volatile std::sig_atomic_t active_trap_scopes = 0;
+
+inline std::string trap_message(int exceptions)
+{
+    if (exceptions & FE_INVALID) return "Invalid result from arithmetic operation trapped";
+    if (exceptions & FE_DIVBYZERO) return "Division by zero trapped";
+    if (exceptions & FE_OVERFLOW) return "Overflow to infinite trapped";
+    if (exceptions & FE_UNDERFLOW) return "Underflow trapped";
+    return "Non reversible operation trapped";
+}
+
+#ifdef BOOST_SAFE_FLOAT_HAS_FPE_TRAPS
+// The exceptions trapping in SSE, their masks are 7 bits above the flags in MXCSR
+inline int sse_traps()
+{
+    unsigned int csr;
+    __asm__ __volatile__("stmxcsr %0" : "=m"(csr) : : "memory");
+    return ~(csr >> 7) & FE_ALL_EXCEPT;
+}
+
+inline void set_sse_traps(int exceptions)
+{
+    unsigned int csr;
+    __asm__ __volatile__("stmxcsr %0" : "=m"(csr) : : "memory");
+    csr = (csr | (FE_ALL_EXCEPT << 7)) & ~(unsigned(exceptions) << 7);
+    __asm__ __volatile__("ldmxcsr %0" : : "m"(csr) : "memory");
+}
+
+// The x87 sticky flags, the compiler doesn't move the stores after the test
+inline int x87_flags()
+{
+    unsigned short status;
+    __asm__ __volatile__("fnstsw %0" : "=am"(status) : : "memory");
+    return status & FE_ALL_EXCEPT;
+}
+
+inline struct sigaction& previous_sigfpe_action()
+{
+    static struct sigaction previous;
+    return previous;
+}
+
+inline void sigfpe_handler(int signal, siginfo_t* info, void* context)
+{
+    int exception = 0;
+    switch (info->si_code)
+    {
+        case FPE_FLTINV: exception = FE_INVALID; break;
+        case FPE_FLTDIV: exception = FE_DIVBYZERO; break;
+        case FPE_FLTOVF: exception = FE_OVERFLOW; break;
+        case FPE_FLTUND: exception = FE_UNDERFLOW; break;
+        case FPE_FLTRES: exception = FE_INEXACT; break;
+        default: break;
+    }
+
+    if (exception == 0 || active_trap_scopes == 0)
+    {
+        // not ours, give it back to whoever was there before
+        struct sigaction& previous = previous_sigfpe_action();
+        if (previous.sa_flags & SA_SIGINFO)
+            previous.sa_sigaction(signal, info, context);
+        else if (previous.sa_handler != SIG_IGN && previous.sa_handler != SIG_DFL)
+            previous.sa_handler(signal);
+        else
+            std::signal(SIGFPE, SIG_DFL); // the instruction is restarted and terminates the program
+        return;
+    }
+
+    trapped_exceptions = trapped_exceptions | exception;
+
+    // Mask the exceptions raised in the interrupted context only, the other ones keep trapping until check() enables
+    // them back
+    auto* fpu = static_cast<ucontext_t*>(context)->uc_mcontext.fpregs;
+    fpu->mxcsr |= ((fpu->mxcsr & FE_ALL_EXCEPT) | exception) << 7;
+}
+
+// Number of scopes alive in the process, the handler is installed while it isn't 0
+inline std::mutex& sigfpe_handler_mutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+inline int& sigfpe_handler_users()
+{
+    static int users = 0;
+    return users;
+}
+
+// Installs the handler for the first scope, the action replaced is kept to be restored by the last one
+inline void acquire_sigfpe_handler()
+{
+    std::lock_guard<std::mutex> const lock(sigfpe_handler_mutex());
+    if (sigfpe_handler_users()++ != 0) return;
+    struct sigaction action = {};
+    action.sa_sigaction = &sigfpe_handler;
+    action.sa_flags = SA_SIGINFO;
+    sigemptyset(&action.sa_mask);
+    // the previous action is saved before the handler can be called
+    sigaction(SIGFPE, nullptr, &previous_sigfpe_action());
+    sigaction(SIGFPE, &action, nullptr);
+}
+
+inline void release_sigfpe_handler()
+{
+    std::lock_guard<std::mutex> const lock(sigfpe_handler_mutex());
+    if (--sigfpe_handler_users() == 0) sigaction(SIGFPE, &previous_sigfpe_action(), nullptr);
+}
+#endif
+} // namespace detail
+
+/**
+ * RAII object enabling the hardware traps for the exceptions given while it lives
+ */
+template<class ERROR_HANDLING = policy::on_fail_throw>
+class trap_scope : private ERROR_HANDLING
+{
+    int exceptions;
+    int previous_traps;
+    std::sig_atomic_t previous_trapped;
+    int uncaught;
+
+    ERROR_HANDLING& handler() noexcept { return static_cast<ERROR_HANDLING&>(*this); }
+
+public:
+    explicit trap_scope(int exceptions = FE_OVERFLOW | FE_DIVBYZERO | FE_INVALID,
+                        ERROR_HANDLING handler = ERROR_HANDLING{}) :
+        ERROR_HANDLING(handler),
+        exceptions(exceptions),
+        previous_trapped(detail::trapped_exceptions),
+        uncaught(std::uncaught_exceptions())
+    {
+        detail::trapped_exceptions = 0;
+        std::feclearexcept(exceptions);
+#ifdef BOOST_SAFE_FLOAT_HAS_FPE_TRAPS
+        detail::acquire_sigfpe_handler();
+        detail::active_trap_scopes = detail::active_trap_scopes + 1;
+        previous_traps = detail::sse_traps();
+        detail::set_sse_traps(previous_traps | exceptions);
+#else
+        previous_traps = 0;
+#endif
+    }
+
+    // Builds a scope trapping the exceptions a trapped check policy was declared with
+    template<template<class> class CHECK, class FP = double>
+    static trap_scope for_policy(ERROR_HANDLING handler = ERROR_HANDLING{})
+    {
+        return trap_scope(CHECK<FP>::trapped_exceptions, handler);
+    }
+
+    trap_scope(const trap_scope&) = delete;
+    trap_scope& operator=(const trap_scope&) = delete;
+
+    // Exceptions trapped since the scope was entered, or the last call to check()
+    int raised() const noexcept
+    {
+#ifdef BOOST_SAFE_FLOAT_HAS_FPE_TRAPS
+        return (detail::trapped_exceptions | detail::x87_flags()) & exceptions;
+#else
+        return std::fetestexcept(exceptions);
+#endif
+    }
+
+    // Reports the exceptions trapped so far and keeps trapping
+    void check()
+    {
+        int const trapped = raised();
+        if (trapped == 0) return;
+        detail::trapped_exceptions = 0;
+        std::feclearexcept(exceptions);
+#ifdef BOOST_SAFE_FLOAT_HAS_FPE_TRAPS
+        // the handler masked the exceptions, enable them back
+        detail::set_sse_traps(detail::sse_traps() | exceptions);
+#endif
+        handler().report_failure(detail::trap_message(trapped));
+    }
+
+    ~trap_scope() noexcept(false)
+    {
+        int const trapped = raised();
+#ifdef BOOST_SAFE_FLOAT_HAS_FPE_TRAPS
+        detail::set_sse_traps(previous_traps);
+        detail::active_trap_scopes = detail::active_trap_scopes - 1;
+        detail::release_sigfpe_handler();
+#endif
+        detail::trapped_exceptions = previous_trapped;
+        // don't report while unwinding the stack for another error
+        if (trapped != 0 && std::uncaught_exceptions() == uncaught)
+            handler().report_failure(detail::trap_message(trapped));
+    }
+};
+
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_TRAP_HPP
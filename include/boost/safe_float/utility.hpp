@@ -18,9 +18,41 @@ struct is_safe_float : std::false_type {};
 template<typename SF, template<typename> typename CHECK, typename REPORT, template<typename> typename CAST>
 struct is_safe_float<safe_float<SF, CHECK, REPORT, CAST>> : std::true_type {};
 
+// A safe_float having the size, the alignment and the layout of its FP, as it has with stateless policies: an array of
+// it can be used in place of an array of FP
+template<typename T, typename = void>
+struct has_fp_layout : std::false_type {};
+
+template<typename SF>
+struct has_fp_layout<SF, std::enable_if_t<is_safe_float<SF>::value>> :
+    std::bool_constant<sizeof(SF) == sizeof(typename SF::value_type)
+                       && alignof(SF) == alignof(typename SF::value_type) && std::is_standard_layout<SF>::value
+                       && std::is_trivially_copyable<SF>::value> {};
+
+// Stops the compilation of the code using an array of SF as an array of its FP when SF doesn't have its layout
+template<typename SF>
+constexpr void require_fp_layout() noexcept
+{
+    static_assert(has_fp_layout<SF>::value,
+                  "An array of safe_float is used as an array of its FP, it needs the layout of FP: stateless policies");
+}
+
 
 namespace policy
 {
+// True during the constant evaluation of a constexpr function: the checks then don't access the fenv flags and the
+// failures don't reach the error handling
+constexpr bool is_constant_evaluated() noexcept
+{
+#if defined(__cpp_lib_is_constant_evaluated)
+    return std::is_constant_evaluated();
+#elif defined(__GNUC__) || defined(__clang__)
+    return __builtin_is_constant_evaluated();
+#else
+    return false;
+#endif
+}
+
 template<template<typename...> typename A, template<typename...> typename B>
 struct is_same_template : std::false_type
 {};
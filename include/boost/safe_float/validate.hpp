@@ -0,0 +1,220 @@
+#ifndef BOOST_SAFE_FLOAT_VALIDATE_HPP
+#define BOOST_SAFE_FLOAT_VALIDATE_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#if __has_include(<span>)
+#    include <span>
+#endif
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/batch.hpp>
+#include <boost/safe_float/policy/classify.hpp>
+#include <boost/safe_float/simd.hpp>
+
+// This file defines the validation of arrays of FP before they are used as arrays of safe_float.
+// The float and double arrays are scanned by vectors of the widest registers of the target, four at once, with the
+// exponent tests of simd.hpp. Only the vectors holding a rejected value are scanned again value by value to find the
+// first one. A validated array is used in place as an array of a safe_float having the layout of its FP.
+
+namespace boost
+{
+namespace safe_float
+{
+namespace validation
+{
+// Classes of values rejected by the validation, combined as bits
+enum class value_class : unsigned
+{
+    none = 0,
+    nan = 1,
+    infinite = 2,
+    subnormal = 4
+};
+
+constexpr value_class operator|(value_class lhs, value_class rhs) noexcept
+{
+    return static_cast<value_class>(static_cast<unsigned>(lhs) | static_cast<unsigned>(rhs));
+}
+
+constexpr bool contains(value_class classes, value_class c) noexcept
+{
+    return (static_cast<unsigned>(classes) & static_cast<unsigned>(c)) != 0;
+}
+
+constexpr value_class non_finite = value_class::nan | value_class::infinite;
+constexpr value_class all = non_finite | value_class::subnormal;
+
+struct result
+{
+    // index of the first value rejected, the number of values when none is
+    std::size_t index;
+    // class of the value rejected, none when every value is accepted
+    value_class category;
+
+    explicit operator bool() const noexcept { return category == value_class::none; }
+};
+
+// The values a safe_float doesn't hold: the non finite ones, and the subnormal ones when its check policy detects
+// underflows
+template<class SF>
+constexpr value_class rejected_by() noexcept
+{
+    using category = policy::detected_category<typename SF::value_type, typename SF::check_policy,
+                                               policy::failure_category::underflow>;
+    bool const underflow = category::addition || category::subtraction || category::multiplication
+                           || category::division;
+    return underflow ? all : non_finite;
+}
+
+namespace detail
+{
+// The classes rejected are template arguments, the tests of the classes accepted aren't in the loops
+template<value_class REJECTED, class FP>
+value_class classify_value(const FP& value)
+{
+    if constexpr (contains(REJECTED, value_class::nan) && contains(REJECTED, value_class::infinite))
+    {
+        if (!policy::classify::is_finite(value))
+            return policy::classify::is_nan(value) ? value_class::nan : value_class::infinite;
+    }
+    else if constexpr (contains(REJECTED, value_class::nan))
+    {
+        if (policy::classify::is_nan(value)) return value_class::nan;
+    }
+    else if constexpr (contains(REJECTED, value_class::infinite))
+    {
+        if (policy::classify::is_inf(value)) return value_class::infinite;
+    }
+    if constexpr (contains(REJECTED, value_class::subnormal))
+        if (policy::classify::is_subnormal(value)) return value_class::subnormal;
+    return value_class::none;
+}
+
+template<value_class REJECTED, class FP>
+result scan_values(const FP* values, std::size_t first, std::size_t last)
+{
+    for (std::size_t i = first; i < last; ++i)
+    {
+        value_class const c = classify_value<REJECTED>(values[i]);
+        if (c != value_class::none) return {i, c};
+    }
+    return {last, value_class::none};
+}
+
+// Lanes of v holding a rejected value
+template<value_class REJECTED, class FP, std::size_t N>
+typename simd::detail::vector<FP, N>::mask rejected_lanes(const typename simd::detail::vector<FP, N>::type& v)
+{
+    typename simd::detail::vector<FP, N>::mask lanes{};
+    if constexpr (contains(REJECTED, value_class::nan) && contains(REJECTED, value_class::infinite))
+        lanes |= ~simd::detail::is_finite<FP, N>(v);
+    else if constexpr (contains(REJECTED, value_class::nan))
+        lanes |= simd::detail::is_nan<FP, N>(v);
+    else if constexpr (contains(REJECTED, value_class::infinite))
+        lanes |= simd::detail::is_inf<FP, N>(v);
+    if constexpr (contains(REJECTED, value_class::subnormal)) lanes |= simd::detail::is_subnormal<FP, N>(v);
+    return lanes;
+}
+
+template<value_class REJECTED, class FP>
+result scan(const FP* values, std::size_t size)
+{
+    if constexpr (std::is_same_v<FP, float> || std::is_same_v<FP, double>)
+    {
+        constexpr std::size_t lanes = policy::fenv_flags::detail::vector_register_size / sizeof(FP);
+        constexpr std::size_t block = 4 * lanes;
+        using vec = typename simd::detail::vector<FP, lanes>::type;
+        std::size_t i = 0;
+        for (; i + block <= size; i += block)
+        {
+            vec v[4];
+            std::memcpy(v, values + i, sizeof(v));
+            auto const any = rejected_lanes<REJECTED, FP, lanes>(v[0]) | rejected_lanes<REJECTED, FP, lanes>(v[1])
+                             | rejected_lanes<REJECTED, FP, lanes>(v[2]) | rejected_lanes<REJECTED, FP, lanes>(v[3]);
+            if (simd::detail::any_lane<FP, lanes>(any)) return scan_values<REJECTED>(values, i, i + block);
+        }
+        return scan_values<REJECTED>(values, i, size);
+    }
+    else
+        return scan_values<REJECTED>(values, 0, size);
+}
+
+template<class FP, unsigned... REJECTED>
+result dispatch(const FP* values, std::size_t size, value_class rejected, std::integer_sequence<unsigned, REJECTED...>)
+{
+    result r{size, value_class::none};
+    ((static_cast<unsigned>(rejected) == REJECTED ? (void)(r = scan<static_cast<value_class>(REJECTED)>(values, size))
+                                                  : (void)0),
+     ...);
+    return r;
+}
+
+inline const char* message(value_class c)
+{
+    switch (c)
+    {
+        case value_class::nan: return "NaN value";
+        case value_class::infinite: return "Infinite value";
+        case value_class::subnormal: return "Subnormal value";
+        default: return "Valid value";
+    }
+}
+} // namespace detail
+
+// The first of the size values that is of a rejected class
+template<class FP>
+result validate(const FP* values, std::size_t size, value_class rejected = non_finite)
+{
+    static_assert(std::is_floating_point<FP>::value, "Validation works on floating point data types");
+    return detail::dispatch(values, size, rejected, std::make_integer_sequence<unsigned, 8>{});
+}
+
+// The values as an array of SF when they are all held by SF. The first value rejected is given to the handler, with
+// its index, through report_batch_failure(message, index) when it provides it, otherwise appended to the message given
+// to report_failure. The values aren't copied.
+template<class SF, class ERROR_HANDLING = typename SF::report_policy>
+const SF* as_safe_float(const typename SF::value_type* values, std::size_t size,
+                        ERROR_HANDLING handler = ERROR_HANDLING{})
+{
+    require_fp_layout<SF>();
+    result const r = validate(values, size, rejected_by<SF>());
+    if (!r) batch::detail::report_batch_failure(handler, detail::message(r.category), r.index);
+    return reinterpret_cast<const SF*>(values);
+}
+
+template<class SF, class ERROR_HANDLING = typename SF::report_policy>
+SF* as_safe_float(typename SF::value_type* values, std::size_t size, ERROR_HANDLING handler = ERROR_HANDLING{})
+{
+    as_safe_float<SF>(const_cast<const typename SF::value_type*>(values), size, handler);
+    return reinterpret_cast<SF*>(values);
+}
+
+#ifdef __cpp_lib_span
+template<class FP>
+result validate(std::span<const FP> values, value_class rejected = non_finite)
+{
+    return validate(values.data(), values.size(), rejected);
+}
+
+template<class SF, class ERROR_HANDLING = typename SF::report_policy>
+std::span<const SF> as_safe_float(std::span<const typename SF::value_type> values,
+                                  ERROR_HANDLING handler = ERROR_HANDLING{})
+{
+    return {as_safe_float<SF>(values.data(), values.size(), handler), values.size()};
+}
+
+template<class SF, class ERROR_HANDLING = typename SF::report_policy>
+std::span<SF> as_safe_float(std::span<typename SF::value_type> values, ERROR_HANDLING handler = ERROR_HANDLING{})
+{
+    return {as_safe_float<SF>(values.data(), values.size(), handler), values.size()};
+}
+#endif
+
+} // namespace validation
+} // namespace safe_float
+} // namespace boost
+
+#endif // BOOST_SAFE_FLOAT_VALIDATE_HPP
@@ -0,0 +1,12 @@
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/convenience.hpp>
+#include <boost/safe_float/literals.hpp>
+
+using namespace boost::safe_float::literals;
+
+int main()
+{
+    // 2^-200 is rounded to 0 in float, the default policy rejects it
+    auto f = 0x1p-200_sf;
+    return f.get_stored_value() > 0 ? 0 : 1;
+}
@@ -0,0 +1,16 @@
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/convenience.hpp>
+#include <boost/safe_float/literals.hpp>
+
+using namespace boost::safe_float;
+
+using exact_double = safe_float<double, policy::check_inexact_rounding_eft>;
+
+BOOST_SAFE_FLOAT_LITERAL(_exact, exact_double)
+
+int main()
+{
+    // 0.1 is rounded to double, the policy rejects it
+    exact_double d = 0.1_exact;
+    return d.get_stored_value() > 0 ? 0 : 1;
+}
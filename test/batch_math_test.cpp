@@ -0,0 +1,239 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/batch_math.hpp>
+#include <boost/safe_float/convenience.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+template<class FP>
+using unchecked = policy::check_policy<FP>;
+
+// steps of nextafter from a to b, up to limit
+template<class FP>
+unsigned ulps(FP a, FP b, unsigned limit = 16)
+{
+    if ((std::isnan(a) && std::isnan(b)) || (a == b && std::signbit(a) == std::signbit(b))) return 0;
+    if (std::isnan(a) || std::isnan(b)) return limit;
+    unsigned steps = 0;
+    for (; a != b && steps < limit; ++steps) a = std::nextafter(a, b);
+    return steps;
+}
+
+// largest distance of the batch results to the ones of <cmath>
+template<class SF, class BATCH, class SCALAR>
+unsigned max_ulps(const std::vector<SF>& x, const std::vector<SF>& y, BATCH batch_function, SCALAR scalar_function)
+{
+    std::vector<SF> out(x.size());
+    batch_function(x.data(), y.data(), out.data(), x.size());
+    unsigned distance = 0;
+    for (std::size_t i = 0; i < x.size(); ++i)
+        distance = std::max(distance, ulps(out[i].get_stored_value(),
+                                           scalar_function(x[i].get_stored_value(), y[i].get_stored_value())));
+    return distance;
+}
+
+template<class SF>
+std::vector<SF> uniform(std::size_t size, double low, double high, bool logarithmic = false)
+{
+    std::mt19937_64 generator(size);
+    std::uniform_real_distribution<double> distribution(low, high);
+    std::vector<SF> values;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        double const v = distribution(generator);
+        values.emplace_back(typename SF::value_type(logarithmic ? std::exp(v) : v));
+    }
+    return values;
+}
+
+/**
+  This test suite checks the batch math functions against <cmath> and the failures they report with their index.
+  */
+BOOST_AUTO_TEST_SUITE( safe_float_batch_math_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_batch_math_accuracy, FPT, test_types){
+    using sf = safe_float<FPT, unchecked>;
+    constexpr std::size_t size = 20011;
+    // the results are within 2 ulps of the ones of <cmath>, long double values are evaluated by <cmath>
+    unsigned const tolerance = std::is_same<FPT, long double>::value ? 0 : 2;
+    auto const x = uniform<sf>(size, -80, 80);
+    auto const positive = uniform<sf>(size, -700, 700, true);
+    auto const close_to_one = uniform<sf>(size, 0.7, 1.4);
+    auto const exponents = uniform<sf>(size, -60, 60);
+    auto const angles = uniform<sf>(size, -20000, 20000);
+    auto const unary = [](auto function) {
+        return [function](const sf* v, const sf*, sf* out, std::size_t n) { function(v, out, n); };
+    };
+    BOOST_CHECK_LE(max_ulps(x, x, unary([](auto... a) { batch::exp(a...); }), [](FPT v, FPT) { return std::exp(v); }),
+                   tolerance);
+    BOOST_CHECK_LE(
+        max_ulps(positive, x, unary([](auto... a) { batch::log(a...); }), [](FPT v, FPT) { return std::log(v); }),
+        tolerance);
+    BOOST_CHECK_LE(
+        max_ulps(close_to_one, x, unary([](auto... a) { batch::log(a...); }), [](FPT v, FPT) { return std::log(v); }),
+        tolerance);
+    BOOST_CHECK_EQUAL(
+        max_ulps(positive, x, unary([](auto... a) { batch::sqrt(a...); }), [](FPT v, FPT) { return std::sqrt(v); }),
+        0u);
+    BOOST_CHECK_LE(
+        max_ulps(angles, x, unary([](auto... a) { batch::sin(a...); }), [](FPT v, FPT) { return std::sin(v); }),
+        tolerance);
+    BOOST_CHECK_LE(
+        max_ulps(angles, x, unary([](auto... a) { batch::cos(a...); }), [](FPT v, FPT) { return std::cos(v); }),
+        tolerance);
+    BOOST_CHECK_LE(max_ulps(close_to_one, exponents, [](auto... a) { batch::pow(a...); },
+                            [](FPT v, FPT w) { return std::pow(v, w); }),
+                   tolerance);
+    // the large exponents of pow magnify the error on the logarithm
+    auto const large_exponents = uniform<sf>(size, -2000, 2000);
+    BOOST_CHECK_LE(max_ulps(close_to_one, large_exponents, [](auto... a) { batch::pow(a...); },
+                            [](FPT v, FPT w) { return std::pow(v, w); }),
+                   tolerance);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_batch_math_special_values, FPT, test_types){
+    using sf = safe_float<FPT, unchecked>;
+    using limits = std::numeric_limits<FPT>;
+    std::vector<FPT> const values{0, -FPT(0), 1, -1, FPT(0.5), -FPT(2.5), 3, -3, FPT(1e-30), limits::min(),
+                                  limits::denorm_min(), limits::max(), -limits::max(), limits::infinity(),
+                                  -limits::infinity(), limits::quiet_NaN(), FPT(-80), FPT(80), FPT(1e7)};
+    std::vector<sf> x, y;
+    for (FPT v : values)
+        for (FPT w : values)
+        {
+            x.emplace_back(v);
+            y.emplace_back(w);
+        }
+    // the subnormal results may differ by a few denorm_min
+    auto const close = [](FPT a, FPT b) {
+        return ulps(a, b) <= 2 || std::fabs(a - b) <= 4 * limits::denorm_min();
+    };
+    std::vector<sf> out(x.size());
+    batch::pow(x.data(), y.data(), out.data(), x.size());
+    for (std::size_t i = 0; i < x.size(); ++i)
+        BOOST_CHECK(close(out[i].get_stored_value(), std::pow(x[i].get_stored_value(), y[i].get_stored_value())));
+#define BOOST_SAFE_FLOAT_CHECK_SPECIAL_VALUES(function)                                                     \
+    batch::function(x.data(), out.data(), x.size());                                                      \
+    for (std::size_t i = 0; i < x.size(); ++i)                                                            \
+        BOOST_CHECK(close(out[i].get_stored_value(), std::function(x[i].get_stored_value())));
+    BOOST_SAFE_FLOAT_CHECK_SPECIAL_VALUES(exp)
+    BOOST_SAFE_FLOAT_CHECK_SPECIAL_VALUES(log)
+    BOOST_SAFE_FLOAT_CHECK_SPECIAL_VALUES(sqrt)
+    BOOST_SAFE_FLOAT_CHECK_SPECIAL_VALUES(sin)
+    BOOST_SAFE_FLOAT_CHECK_SPECIAL_VALUES(cos)
+#undef BOOST_SAFE_FLOAT_CHECK_SPECIAL_VALUES
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_batch_math_failing_index, FPT, test_types){
+    using sf = safe_float<FPT, policy::check_bothflow>;
+    std::vector<sf> x(37, sf(FPT(2))), out(x.size());
+    BOOST_CHECK_NO_THROW(batch::exp(x.data(), out.data(), x.size()));
+    BOOST_CHECK_EQUAL(out[36].get_stored_value(), std::exp(FPT(2)));
+    // certain from the argument, before the evaluation, in the vectors and the remaining values
+    for (std::size_t index : {std::size_t(3), std::size_t(36)})
+    {
+        auto copy = x;
+        copy[index] = sf(FPT(100000));
+        copy[index == 3 ? 20 : 0] = sf(-FPT(100000));
+        try
+        {
+            batch::exp(copy.data(), out.data(), copy.size());
+            BOOST_ERROR("An exception is supposed to be thrown");
+        }
+        catch (policy::batch_failure& e)
+        {
+            BOOST_CHECK_EQUAL(e.index(), index == 3 ? 3u : 0u);
+            BOOST_CHECK_EQUAL(e.what(), std::string(index == 3 ? "Overflow to infinite on exp function"
+                                                               : "Underflow from exp function"));
+        }
+    }
+    // from the result
+    auto copy = x;
+    copy[11] = sf(std::numeric_limits<FPT>::max());
+    std::vector<sf> y(x.size(), sf(FPT(3)));
+    try
+    {
+        batch::pow(copy.data(), y.data(), out.data(), copy.size());
+        BOOST_ERROR("An exception is supposed to be thrown");
+    }
+    catch (policy::batch_failure& e)
+    {
+        BOOST_CHECK_EQUAL(e.index(), 11u);
+        BOOST_CHECK_EQUAL(e.what(), std::string("Overflow to infinite on pow function"));
+    }
+    // not checked by the policy
+    copy[11] = sf(FPT(-1));
+    BOOST_CHECK_NO_THROW(batch::log(copy.data(), out.data(), copy.size()));
+    BOOST_CHECK(std::isnan(out[11].get_stored_value()));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_batch_math_policies, FPT, test_types){
+    // the square roots of the squares are exact
+    std::vector<safe_float<FPT>> squares, out(20);
+    for (int i = 0; i < 20; ++i) squares.emplace_back(FPT(i * i));
+    BOOST_CHECK_NO_THROW(batch::sqrt(squares.data(), out.data(), squares.size()));
+    BOOST_CHECK_EQUAL(out[19].get_stored_value(), FPT(19));
+    squares[13] = safe_float<FPT>(FPT(2));
+    try
+    {
+        batch::sqrt(squares.data(), out.data(), squares.size());
+        BOOST_ERROR("An exception is supposed to be thrown");
+    }
+    catch (policy::batch_failure& e)
+    {
+        BOOST_CHECK_EQUAL(e.index(), 13u);
+        BOOST_CHECK_EQUAL(e.what(), std::string("Non reversible sqrt applied"));
+    }
+    // the finite policies report the non finite results
+    using finite = safe_float<FPT, policy::check_finite>;
+    std::vector<finite> angles(9, finite(FPT(1))), sines(9);
+    angles[5] = finite(std::numeric_limits<FPT>::quiet_NaN());
+    try
+    {
+        batch::sin(angles.data(), sines.data(), angles.size());
+        BOOST_ERROR("An exception is supposed to be thrown");
+    }
+    catch (policy::batch_failure& e)
+    {
+        BOOST_CHECK_EQUAL(e.index(), 5u);
+        BOOST_CHECK_EQUAL(e.what(), std::string("Non finite operand given to sin function"));
+    }
+}
+
+// handler without report_batch_failure gets the index in the message
+struct keep_message : policy::on_fail_policy
+{
+    std::string* last;
+    void report_failure(const std::string& s) { *last = s; }
+};
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_batch_math_plain_handler, FPT, test_types){
+    using sf = safe_float<FPT, policy::check_invalid_result>;
+    std::vector<sf> x{sf(FPT(1)), sf(FPT(-1)), sf(FPT(2))}, out(3);
+    std::string message;
+    keep_message handler;
+    handler.last = &message;
+    batch::log(x.data(), out.data(), x.size(), handler);
+    BOOST_CHECK_EQUAL(message, "Domain error on log function (element 1)");
+#ifdef __cpp_lib_span
+    batch::cos(std::span<const sf>(x), std::span<sf>(out).first(2), handler);
+    BOOST_CHECK_EQUAL(message, "Batch operands and output have different sizes");
+#endif
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,98 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/batch.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+/**
+  This test suite checks the batch operations report the first failing element.
+  */
+BOOST_AUTO_TEST_SUITE( safe_float_batch_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_batch_success, FPT, test_types){
+    std::vector<FPT> a{1, 2, 3, 4}, b{4, 3, 2, 1}, out(4);
+
+    BOOST_CHECK_NO_THROW(checked_add(a.data(), b.data(), out.data(), out.size()));
+    BOOST_CHECK(out == (std::vector<FPT>{5, 5, 5, 5}));
+    BOOST_CHECK_NO_THROW(checked_sub<policy::check_overflow>(a.data(), b.data(), out.data(), out.size()));
+    BOOST_CHECK(out == (std::vector<FPT>{-3, -1, 1, 3}));
+    BOOST_CHECK_NO_THROW(checked_mul(a.data(), b.data(), out.data(), out.size()));
+    BOOST_CHECK(out == (std::vector<FPT>{4, 6, 6, 4}));
+    BOOST_CHECK_NO_THROW(checked_div<policy::check_division_by_zero>(a.data(), b.data(), out.data(), out.size()));
+    BOOST_CHECK(out[3] == 4);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_batch_failing_index, FPT, test_types){
+    FPT max = std::numeric_limits<FPT>::max();
+    std::vector<FPT> a{1, max, 1, max}, b{1, 1, 1, 1}, out(4);
+
+    // only the overflowing elements fail, the first one is reported
+    a[1] = 1;
+    b[3] = max;
+    try
+    {
+        checked_add<policy::check_overflow>(a.data(), b.data(), out.data(), out.size());
+        BOOST_ERROR("An exception is supposed to be thrown");
+    }
+    catch (policy::batch_failure& e)
+    {
+        BOOST_CHECK_EQUAL(e.index(), 3u);
+        BOOST_CHECK_EQUAL(e.what(), std::string("Overflow to infinite on addition operation"));
+    }
+
+    // the division by zero is detected on the pre check
+    std::vector<FPT> z{1, 1, 0, 0};
+    try
+    {
+        checked_div(b.data(), z.data(), out.data(), out.size());
+        BOOST_ERROR("An exception is supposed to be thrown");
+    }
+    catch (policy::batch_failure& e)
+    {
+        BOOST_CHECK_EQUAL(e.index(), 2u);
+    }
+}
+
+// handler without report_batch_failure gets the index in the message
+struct keep_message : policy::on_fail_policy
+{
+    std::string* last;
+    void report_failure(const std::string& s) { *last = s; }
+};
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_batch_plain_handler, FPT, test_types){
+    std::vector<FPT> a{0, 1}, b{0, 0}, out(2);
+    std::string message;
+    keep_message handler;
+    handler.last = &message;
+
+    checked_div<policy::check_invalid_result>(a.data(), b.data(), out.data(), out.size(), handler);
+    BOOST_CHECK_EQUAL(message, std::string("Invalid result from arithmetic operation obtained (element 0)"));
+}
+
+#ifdef __cpp_lib_span
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_batch_span, FPT, test_types){
+    std::vector<FPT> a{1, 2}, b{std::numeric_limits<FPT>::max(), std::numeric_limits<FPT>::max()}, out(2);
+
+    BOOST_CHECK_NO_THROW(checked_add(std::span<const FPT>(a), std::span<const FPT>(a), std::span<FPT>(out)));
+    BOOST_CHECK_THROW(checked_mul(std::span<const FPT>(a), std::span<const FPT>(b), std::span<FPT>(out)),
+                      policy::batch_failure);
+    BOOST_CHECK_THROW(checked_mul(std::span<const FPT>(a), std::span<const FPT>(b), std::span<FPT>(out).first(1)),
+                      std::exception);
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
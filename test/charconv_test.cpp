@@ -0,0 +1,82 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <string>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/charconv.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+/**
+  This test suite checks the conversions of safe_float from and to text, and the parse errors reported to the handler.
+  */
+BOOST_AUTO_TEST_SUITE( safe_float_charconv_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_charconv_round_trip, FPT, test_types){
+    char buffer[64];
+    for (FPT v : {FPT(0.5), FPT(-3), std::numeric_limits<FPT>::max(), std::numeric_limits<FPT>::min(),
+                  FPT(1) / FPT(3)})
+    {
+        safe_float<FPT> const value(v);
+        auto const written = to_chars(buffer, buffer + sizeof(buffer), value);
+        BOOST_REQUIRE(written.ec == std::errc{});
+        safe_float<FPT> read;
+        auto const parsed = from_chars(buffer, written.ptr, read);
+        BOOST_CHECK(parsed.ec == std::errc{});
+        BOOST_CHECK(parsed.ptr == written.ptr);
+        BOOST_CHECK_EQUAL(read.get_stored_value(), v);
+    }
+    auto const fixed = to_chars(buffer, buffer + sizeof(buffer), safe_float<FPT>(FPT(0.25)), std::chars_format::fixed, 3);
+    BOOST_CHECK_EQUAL(std::string(buffer, fixed.ptr), "0.250");
+    // the buffer is too small, nothing is reported
+    auto const small = to_chars(buffer, buffer + 2, safe_float<FPT>(FPT(0.25)));
+    BOOST_CHECK(small.ec == std::errc::value_too_large);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_charconv_failures, FPT, test_types){
+    safe_float<FPT> value(FPT(2));
+    char const* const invalid = "x1.5";
+    BOOST_CHECK_THROW(from_chars(invalid, invalid + std::strlen(invalid), value), std::exception);
+    char const* const huge = "1e99999";
+    BOOST_CHECK_THROW(from_chars(huge, huge + std::strlen(huge), value), std::exception);
+    // the value isn't changed by the failures
+    BOOST_CHECK_EQUAL(value.get_stored_value(), FPT(2));
+    // the parse stops at the first character that isn't part of the number
+    char const* const field = "1.5,2";
+    auto const parsed = from_chars(field, field + std::strlen(field), value);
+    BOOST_CHECK_EQUAL(*parsed.ptr, ',');
+    BOOST_CHECK_EQUAL(value.get_stored_value(), FPT(1.5));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_charconv_streams, FPT, test_types){
+    safe_float<FPT> value(FPT(2));
+    std::istringstream huge("1e99999");
+    BOOST_CHECK_THROW(huge >> value, std::exception);
+    BOOST_CHECK_EQUAL(value.get_stored_value(), FPT(2));
+    std::istringstream valid("0.75");
+    valid >> value;
+    BOOST_CHECK_EQUAL(value.get_stored_value(), FPT(0.75));
+    std::ostringstream out;
+    out << value;
+    BOOST_CHECK_EQUAL(out.str(), "0.75");
+}
+
+#ifdef __cpp_lib_format
+BOOST_AUTO_TEST_CASE( safe_float_charconv_format ){
+    BOOST_CHECK_EQUAL(std::format("{:.2f}", safe_float<double>(0.25)), "0.25");
+    BOOST_CHECK_EQUAL(std::format("{}", safe_float<float>(1.5f)), "1.5");
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,53 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <cmath>
+#include <limits>
+
+#include <boost/safe_float/policy/classify.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float::policy;
+
+/**
+  This test suite checks the bit level classification gives the results of the <cmath> functions.
+  */
+BOOST_AUTO_TEST_SUITE( safe_float_classify_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_classify_special_values, FPT, test_types){
+    using limits = std::numeric_limits<FPT>;
+    FPT const values[] = {0, 1, limits::min(), limits::max(), limits::lowest(), limits::denorm_min(),
+                          limits::min() - limits::denorm_min(), limits::min() / 2, limits::epsilon(),
+                          limits::infinity(), limits::quiet_NaN(), limits::signaling_NaN()};
+    for (FPT positive : values)
+    {
+        for (FPT v : {positive, -positive})
+        {
+            BOOST_CHECK_EQUAL(classify::is_inf(v), std::isinf(v));
+            BOOST_CHECK_EQUAL(classify::is_nan(v), std::isnan(v));
+            BOOST_CHECK_EQUAL(classify::is_finite(v), std::isfinite(v));
+            BOOST_CHECK_EQUAL(classify::is_subnormal(v), std::fpclassify(v) == FP_SUBNORMAL);
+            BOOST_CHECK_EQUAL(classify::is_zero(v), std::fpclassify(v) == FP_ZERO);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_classify_computed_values, FPT, test_types){
+    // results of operations, not only the values of the constants
+    FPT const max = std::numeric_limits<FPT>::max();
+    FPT const min = std::numeric_limits<FPT>::min();
+    volatile FPT zero = 0;
+    BOOST_CHECK(classify::is_inf(max * 2));
+    BOOST_CHECK(classify::is_nan(zero / zero));
+    BOOST_CHECK(classify::is_subnormal(min / 3));
+    BOOST_CHECK(classify::is_zero(min * min));
+    BOOST_CHECK(!classify::is_subnormal(min * 3));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,131 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <cmath>
+#include <limits>
+#include <string>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/cmath.hpp>
+#include <boost/safe_float/convenience.hpp>
+#include <boost/safe_float/policy/on_fail_deferred.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+// message reported by the function call, empty when it passes
+template<class F>
+std::string failure_message(F f)
+{
+    try
+    {
+        f();
+    }
+    catch (std::exception& e)
+    {
+        return e.what();
+    }
+    return std::string();
+}
+
+/**
+  This test suite checks the math functions of safe_float compute as <cmath> and report the failures their policy
+  checks.
+  */
+BOOST_AUTO_TEST_SUITE( safe_float_cmath_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_cmath_values, FPT, test_types){
+    using sf = safe_float<FPT, policy::check_overflow>;
+    sf const two(FPT(2)), half(FPT(0.5));
+    BOOST_CHECK_EQUAL(sqrt(two).get_stored_value(), std::sqrt(FPT(2)));
+    BOOST_CHECK_EQUAL(exp(two).get_stored_value(), std::exp(FPT(2)));
+    BOOST_CHECK_EQUAL(log(two).get_stored_value(), std::log(FPT(2)));
+    BOOST_CHECK_EQUAL(pow(two, half).get_stored_value(), std::pow(FPT(2), FPT(0.5)));
+    BOOST_CHECK_EQUAL(hypot(two, half).get_stored_value(), std::hypot(FPT(2), FPT(0.5)));
+    BOOST_CHECK_EQUAL(fma(two, half, two).get_stored_value(), FPT(3));
+    BOOST_CHECK_EQUAL(sin(half).get_stored_value(), std::sin(FPT(0.5)));
+    BOOST_CHECK_EQUAL(atan2(half, two).get_stored_value(), std::atan2(FPT(0.5), FPT(2)));
+    BOOST_CHECK_EQUAL(fabs(-two).get_stored_value(), FPT(2));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_cmath_failures, FPT, test_types){
+    using limits = std::numeric_limits<FPT>;
+    using sf = safe_float<FPT>;
+    sf const zero(FPT(0)), one(FPT(1)), two(FPT(2)), big(FPT(100000)), max(limits::max());
+    // certain from the arguments
+    BOOST_CHECK_EQUAL(failure_message([&] { sqrt(-one); }), "Domain error on sqrt function");
+    BOOST_CHECK_EQUAL(failure_message([&] { log(-one); }), "Domain error on log function");
+    BOOST_CHECK_EQUAL(failure_message([&] { log(zero); }), "Pole error on log function");
+    BOOST_CHECK_EQUAL(failure_message([&] { exp(big); }), "Overflow to infinite on exp function");
+    BOOST_CHECK_EQUAL(failure_message([&] { exp(-big); }), "Underflow from exp function");
+    BOOST_CHECK_EQUAL(failure_message([&] { asin(two); }), "Domain error on asin function");
+    BOOST_CHECK_EQUAL(failure_message([&] { pow(zero, -one); }), "Pole error on pow function");
+    BOOST_CHECK_EQUAL(failure_message([&] { pow(-two, sf(FPT(0.5))); }), "Domain error on pow function");
+    // found on the result
+    BOOST_CHECK_EQUAL(failure_message([&] { pow(max, two); }), "Overflow to infinite on pow function");
+    BOOST_CHECK_EQUAL(failure_message([&] { hypot(max, max); }), "Overflow to infinite on hypot function");
+    BOOST_CHECK_EQUAL(failure_message([&] { fma(max, two, -one); }), "Overflow to infinite on fma function");
+    BOOST_CHECK_EQUAL(failure_message([&] { sinh(big); }), "Overflow to infinite on sinh function");
+    BOOST_CHECK_EQUAL(failure_message([&] { sqrt(two); }), "Non reversible sqrt applied");
+    BOOST_CHECK_EQUAL(failure_message([&] { sqrt(sf(FPT(4))); }), "");
+    BOOST_CHECK_EQUAL(failure_message([&] { cos(one); }), "");
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_cmath_policies, FPT, test_types){
+    FPT const inf = std::numeric_limits<FPT>::infinity();
+    // only the categories of the policy are reported
+    using overflow_float = safe_float<FPT, policy::check_overflow>;
+    BOOST_CHECK_NO_THROW(log(overflow_float(FPT(-1))));
+    BOOST_CHECK_NO_THROW(sqrt(overflow_float(FPT(2))));
+    BOOST_CHECK_THROW(exp(overflow_float(FPT(100000))), std::exception);
+    BOOST_CHECK(std::isnan(log(overflow_float(FPT(-1))).get_stored_value()));
+    // check_finite reports every non finite result
+    using finite_float = safe_float<FPT, policy::check_finite>;
+    BOOST_CHECK_EQUAL(failure_message([&] { log(finite_float(FPT(0))); }), "Pole error on log function");
+    BOOST_CHECK_EQUAL(failure_message([&] { exp(finite_float(inf)); }), "Non finite operand given to exp function");
+    BOOST_CHECK_NO_THROW(exp(finite_float(FPT(-100000))));
+    // a non finite argument giving a non finite result isn't an overflow
+    BOOST_CHECK_NO_THROW(exp(overflow_float(inf)));
+    BOOST_CHECK_EQUAL(failure_message([&] { sin(safe_float<FPT>(inf)); }), "Domain error on sin function");
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_cmath_certain_results, FPT, test_types){
+    // the arguments certain to fail give the known result without calling the function
+    using sf = safe_float<FPT, policy::check_all, policy::deferred_report>;
+    FPT const inf = std::numeric_limits<FPT>::infinity();
+    sf const zero(FPT(0)), one(FPT(1)), big(FPT(100000));
+    checked_region<> region;
+    BOOST_CHECK_EQUAL(exp(big).get_stored_value(), inf);
+    BOOST_CHECK_EQUAL(exp(-big).get_stored_value(), FPT(0));
+    BOOST_CHECK_EQUAL(log(zero).get_stored_value(), -inf);
+    BOOST_CHECK(std::isnan(log(-one).get_stored_value()));
+    BOOST_CHECK(std::isnan(sqrt(-one).get_stored_value()));
+    BOOST_CHECK_EQUAL(sinh(-big).get_stored_value(), -inf);
+    BOOST_CHECK_EQUAL(cosh(-big).get_stored_value(), inf);
+    BOOST_CHECK_EQUAL(pow(-zero, sf(FPT(-3))).get_stored_value(), -inf);
+    BOOST_CHECK_EQUAL(pow(-zero, sf(FPT(-2))).get_stored_value(), inf);
+    BOOST_CHECK(region.status() != 0);
+    BOOST_CHECK_THROW(region.commit(), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_cmath_subnormal_results, FPT, test_types){
+    // the arguments certain to underflow still give the subnormal result of the function
+    using sf = safe_float<FPT, policy::check_underflow, policy::deferred_report>;
+    FPT const x = math::detail::exp_underflow_bound<FPT> - FPT(0.5);
+    FPT const y = FPT(std::numeric_limits<FPT>::min_exponent) - FPT(2.5);
+    checked_region<> region;
+    BOOST_CHECK_EQUAL(exp(sf(x)).get_stored_value(), std::exp(x));
+    BOOST_CHECK_NE(std::exp(x), FPT(0));
+    BOOST_CHECK_EQUAL(exp2(sf(y)).get_stored_value(), std::exp2(y));
+    BOOST_CHECK_NE(std::exp2(y), FPT(0));
+    BOOST_CHECK(region.status() != 0);
+    BOOST_CHECK_THROW(region.commit(), std::exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,100 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <limits>
+#include <type_traits>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/convenience.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+// true when OPERATION::evaluate() is a constant expression, a check failing in it is not
+template<class OPERATION, typename = void>
+struct is_constant : std::false_type {};
+
+template<class OPERATION>
+struct is_constant<OPERATION, std::void_t<std::integral_constant<bool, (OPERATION::evaluate(), true)>>> :
+    std::true_type {};
+
+template<class FP, template<class> class CHECK, class OPERATION>
+struct operation
+{
+    static constexpr FP evaluate()
+    {
+        return OPERATION{}(safe_float<FP, CHECK>(OPERATION::template lhs<FP>()),
+                           safe_float<FP, CHECK>(OPERATION::template rhs<FP>()))
+            .get_stored_value();
+    }
+};
+
+struct min_by_three
+{
+    template<class FP> static constexpr FP lhs() { return std::numeric_limits<FP>::min(); }
+    template<class FP> static constexpr FP rhs() { return 3; }
+    template<class SF> constexpr SF operator()(SF l, SF r) const { return l / r; }
+};
+
+struct one_by_three
+{
+    template<class FP> static constexpr FP lhs() { return 1; }
+    template<class FP> static constexpr FP rhs() { return 3; }
+    template<class SF> constexpr SF operator()(SF l, SF r) const { return l / r; }
+};
+
+struct inf_minus_one
+{
+    template<class FP> static constexpr FP lhs() { return std::numeric_limits<FP>::infinity(); }
+    template<class FP> static constexpr FP rhs() { return 1; }
+    template<class SF> constexpr SF operator()(SF l, SF r) const { return l - r; }
+};
+
+/**
+  This test suite checks safe_float is usable in constant expressions and a check failing in one is a compile error.
+  */
+BOOST_AUTO_TEST_SUITE( safe_float_constexpr_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_constexpr_arithmetic, FPT, test_types){
+    constexpr safe_float<FPT> half(FPT(0.5)), three(FPT(3));
+    constexpr safe_float<FPT> value = (three + half) * three - half / half;
+    static_assert(value.get_stored_value() == FPT(9.5), "constexpr arithmetic");
+    static_assert(-half < half && half != three && three >= half, "constexpr comparisons");
+    using finite_float = safe_float<FPT, policy::check_finite>;
+    constexpr finite_float third = finite_float(FPT(1)) / finite_float(FPT(3));
+    static_assert(third.get_stored_value() == FPT(1) / FPT(3), "constexpr software checks");
+    BOOST_CHECK_EQUAL(value.get_stored_value(), FPT(9.5));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_constexpr_failures, FPT, test_types){
+    // the operations are constant expressions unchecked, the overflows and invalid operations never are
+    BOOST_CHECK((is_constant<operation<FPT, policy::check_overflow, min_by_three>>::value));
+    BOOST_CHECK((is_constant<operation<FPT, policy::check_overflow, one_by_three>>::value));
+    BOOST_CHECK((is_constant<operation<FPT, policy::check_overflow, inf_minus_one>>::value));
+    // they are not when a check fails
+    BOOST_CHECK((!is_constant<operation<FPT, policy::check_underflow, min_by_three>>::value));
+    BOOST_CHECK((!is_constant<operation<FPT, policy::check_all, min_by_three>>::value));
+    BOOST_CHECK((!is_constant<operation<FPT, policy::check_inexact_rounding_eft, one_by_three>>::value));
+    BOOST_CHECK((!is_constant<operation<FPT, policy::check_finite, inf_minus_one>>::value));
+    // the same operations at run time report to the error handling
+    BOOST_CHECK_THROW((operation<FPT, policy::check_underflow, min_by_three>::evaluate()), std::exception);
+    BOOST_CHECK_THROW((operation<FPT, policy::check_inexact_rounding_eft, one_by_three>::evaluate()), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_constexpr_numeric_limits, FPT, test_types){
+    using limits = std::numeric_limits<safe_float<FPT>>;
+    constexpr safe_float<FPT> max = limits::max();
+    static_assert(max.get_stored_value() == std::numeric_limits<FPT>::max(), "constexpr max");
+    static_assert(limits::lowest() < limits::min(), "constexpr lowest and min");
+    static_assert(std::numeric_limits<safe_float<FPT, policy::check_inexact_rounding_eft>>::is_exact,
+                  "exact with the inexact checks");
+    BOOST_CHECK_EQUAL(max.get_stored_value(), std::numeric_limits<FPT>::max());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
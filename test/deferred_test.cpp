@@ -0,0 +1,92 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/policy/on_fail_deferred.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+template<class FP>
+using deferred_float = safe_float<FP, policy::check_all, policy::deferred_report>;
+
+// handler keeping the last message reported
+struct keep_message
+{
+    std::string* message;
+    void report_failure(const std::string& s) { *message = s; }
+};
+
+/**
+  This test suite checks the failures recorded by deferred_report are reported once by the checked_region.
+  */
+BOOST_AUTO_TEST_SUITE( safe_float_deferred_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_deferred_success, FPT, test_types){
+    deferred_float<FPT> a(FPT(1)), b(FPT(2));
+    BOOST_CHECK_NO_THROW(([&]{
+        checked_region<> region;
+        a += b;
+        a *= b;
+        BOOST_CHECK_EQUAL(region.status(), 0u);
+    }()));
+    BOOST_CHECK(a.get_stored_value() == 6);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_deferred_failure, FPT, test_types){
+    deferred_float<FPT> a(std::numeric_limits<FPT>::max()), b(FPT(0));
+    std::string message;
+    {
+        checked_region<keep_message> region(keep_message{&message});
+        deferred_float<FPT> c = a + a;
+        // the operations keep going after the failure
+        c = a / b;
+        BOOST_CHECK_EQUAL(region.status(), policy::failure_code::addition | policy::failure_code::division);
+        BOOST_CHECK(message.empty());
+    }
+    BOOST_CHECK_EQUAL(message, "Failed operations in checked region: addition division");
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_deferred_commit, FPT, test_types){
+    deferred_float<FPT> const max(std::numeric_limits<FPT>::max());
+    deferred_float<FPT> a(FPT(0));
+    BOOST_CHECK_THROW(([&]{
+        checked_region<> region;
+        a = max * max;
+        BOOST_CHECK_THROW(region.commit(), std::runtime_error);
+        BOOST_CHECK_EQUAL(region.status(), 0u);
+        // reported only once
+        BOOST_CHECK_NO_THROW(region.commit());
+        a = max * max;
+    }()), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE( safe_float_deferred_nested ){
+    deferred_float<double> const max(std::numeric_limits<double>::max());
+    deferred_float<double> a(0.0);
+    std::string outer_message, inner_message;
+    {
+        checked_region<keep_message> outer(keep_message{&outer_message});
+        a = max - (-max);
+        {
+            checked_region<keep_message> inner(keep_message{&inner_message});
+            BOOST_CHECK_EQUAL(inner.status(), 0u);
+            a = max * max;
+        }
+        BOOST_CHECK_EQUAL(outer.status(), policy::failure_code::subtraction);
+    }
+    BOOST_CHECK_EQUAL(inner_message, "Failed operations in checked region: multiplication");
+    BOOST_CHECK_EQUAL(outer_message, "Failed operations in checked region: subtraction");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,179 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/convenience.hpp>
+#include <boost/safe_float/double_double.hpp>
+
+using namespace boost::safe_float;
+using dd = double_double;
+
+// constant evaluation of the operations
+static_assert(dd(1) + dd(2) == dd(3));
+static_assert((dd(1) / 3).high() == 1.0 / 3);
+static_assert(is_floating_point_type<dd> && !fp_traits<dd>::raises_fenv_flags);
+
+/**
+  This test suite checks the arithmetic of double_double, its conversions from and to text and the checks of
+  safe_float<double_double>.
+  */
+BOOST_AUTO_TEST_SUITE( safe_float_double_double_test_suite )
+
+BOOST_AUTO_TEST_CASE( double_double_arithmetic ){
+    dd const tiny = std::ldexp(1.0, -80);
+    dd const sum = dd(1) + tiny;
+    BOOST_CHECK_EQUAL(sum.high(), 1.0);
+    BOOST_CHECK_EQUAL(sum.low(), std::ldexp(1.0, -80));
+    BOOST_CHECK(sum - 1 == tiny);
+    BOOST_CHECK(-sum + sum == 0);
+
+    // (2^53 - 1)^2 = 2^106 - 2^54 + 1 is exact
+    dd const large = 9007199254740991.0;
+    dd const square = large * large;
+    BOOST_CHECK_EQUAL(square.high(), std::ldexp(1.0, 106) - std::ldexp(1.0, 54));
+    BOOST_CHECK_EQUAL(square.low(), 1.0);
+    BOOST_CHECK(square / large == large);
+    BOOST_CHECK(dd(7) / 2 == 3.5);
+
+    // the operations are not correctly rounded, their error is a few 2^-106
+    dd const third = dd(1) / 3;
+    BOOST_CHECK(abs(third * 3 - 1) <= std::numeric_limits<dd>::epsilon());
+    BOOST_CHECK(abs((dd(2) / 7 + third) * 21 - 13) <= std::numeric_limits<dd>::epsilon() * 16);
+    BOOST_CHECK(third < dd(1.0 / 3) || third > dd(1.0 / 3));
+
+    // conversions
+    BOOST_CHECK(dd(std::int64_t(0x7fffffffffffffff)) - dd(std::int64_t(0x7ffffffffffffffe)) == 1);
+    long double const extended = 1.0L / 3;
+    BOOST_CHECK_EQUAL(static_cast<long double>(dd(extended)), extended);
+    BOOST_CHECK_EQUAL(static_cast<double>(third), 1.0 / 3);
+
+    // non finite values
+    dd const max = std::numeric_limits<dd>::max();
+    BOOST_CHECK(std::isfinite(static_cast<double>(max)) && max.low() > 0);
+    BOOST_CHECK(isinf(max + max) && (max + max).low() == 0);
+    BOOST_CHECK(isinf(max * 2));
+    BOOST_CHECK(isnan(std::numeric_limits<dd>::infinity() - std::numeric_limits<dd>::infinity()));
+    BOOST_CHECK(isinf(dd(1) / 0) && isnan(dd(0) / 0));
+    BOOST_CHECK(dd(1) / std::numeric_limits<dd>::infinity() == 0);
+    BOOST_CHECK(std::numeric_limits<dd>::lowest() == -max);
+
+    // the values below 2^-969 lose precision
+    dd const min = std::numeric_limits<dd>::min();
+    BOOST_CHECK_EQUAL(fpclassify(min), FP_NORMAL);
+    BOOST_CHECK_EQUAL(fpclassify(min / 2), FP_SUBNORMAL);
+    BOOST_CHECK_EQUAL(fpclassify(dd(0)), FP_ZERO);
+    BOOST_CHECK_EQUAL(fpclassify(-std::numeric_limits<dd>::infinity()), FP_INFINITE);
+}
+
+BOOST_AUTO_TEST_CASE( double_double_text ){
+    auto const written = [](dd value, std::ios_base::fmtflags flags, int precision) {
+        std::ostringstream out;
+        out.flags(flags);
+        out << std::setprecision(precision) << value;
+        return out.str();
+    };
+    // the doubles are written as double writes them, up to the 36 significant digits of double_double
+    for (double v : {0.1, 1.5, 123456789.0, 1e-10, 9.9999999, -2.5e300, 0.000123, 7.0, -0.0})
+        for (std::ios_base::fmtflags flags :
+             {std::ios_base::fmtflags{}, std::ios_base::fixed, std::ios_base::scientific,
+              std::ios_base::showpoint | std::ios_base::uppercase, std::ios_base::showpos | std::ios_base::scientific})
+            for (int precision : {1, 3, 6, 10, 17})
+            {
+                if (flags == std::ios_base::fixed && std::abs(v) > 1e30) continue;
+                std::ostringstream out;
+                out.flags(flags);
+                out << std::setprecision(precision) << v;
+                BOOST_CHECK_EQUAL(written(v, flags, precision), out.str());
+            }
+    BOOST_CHECK_EQUAL(written(dd(1) / 3, std::ios_base::fmtflags{}, 32), "0.33333333333333333333333333333333");
+    BOOST_CHECK_EQUAL(written(dd(2) / 3 * 1e20, std::ios_base::scientific, 30), "6.666666666666666666666666666667e+19");
+    BOOST_CHECK_EQUAL(written(dd(1) + std::ldexp(1.0, -80), std::ios_base::fixed, 25), "1.0000000000000000000000008");
+    std::string const large = written(-2.5e300, std::ios_base::fixed, 2);
+    BOOST_CHECK_EQUAL(large.substr(0, 37), "-250000000000000013126190063801146189");
+    BOOST_CHECK_EQUAL(large.size(), 305u);
+    BOOST_CHECK_EQUAL(large.find_first_not_of('0', 37), 302u);
+
+    // written with 33 digits and read back
+    for (dd v : {dd(1) / 3, dd(2) / 7 * 1e100, -dd(5) / 3 * 1e-250, std::numeric_limits<dd>::max()})
+    {
+        std::stringstream text;
+        text << std::setprecision(33) << v;
+        dd read;
+        text >> read;
+        BOOST_CHECK(!text.fail());
+        BOOST_CHECK(abs(read - v) <= abs(v) * std::ldexp(1.0, -100));
+    }
+
+    std::istringstream in("  12.5xyz 1e400 -inf nan .5e-3 abc");
+    dd value;
+    in >> value;
+    BOOST_CHECK(value == 12.5);
+    std::string word;
+    in >> word;
+    BOOST_CHECK_EQUAL(word, "xyz");
+    in >> value;
+    BOOST_CHECK(in.fail() && value == std::numeric_limits<dd>::max());
+    in.clear();
+    in >> value;
+    BOOST_CHECK(isinf(value) && value < 0);
+    in >> value;
+    BOOST_CHECK(isnan(value));
+    in >> value;
+    BOOST_CHECK(abs(value - dd(5) / 10000) <= std::ldexp(1.0, -115));
+    in >> value;
+    BOOST_CHECK(in.fail());
+}
+
+BOOST_AUTO_TEST_CASE( safe_float_double_double_checks ){
+    using sf = safe_float<dd>;
+    sf const one(dd(1)), three(dd(3));
+    // exact in double_double, rounded in double
+    BOOST_CHECK_NO_THROW(one + sf(dd(std::ldexp(1.0, -80))));
+    BOOST_CHECK_THROW(safe_float<double>(1.0) + safe_float<double>(std::ldexp(1.0, -80)), std::exception);
+    // 1 + 2^-60 + 2^-200 needs three doubles
+    BOOST_CHECK_THROW(sf(dd(1) + std::ldexp(1.0, -60)) + sf(dd(std::ldexp(1.0, -200))), std::exception);
+    BOOST_CHECK_NO_THROW(three * three / three);
+
+    using of = safe_float<dd, policy::check_overflow>;
+    of const max(std::numeric_limits<dd>::max());
+    BOOST_CHECK_THROW(max * of(dd(2)), std::exception);
+    BOOST_CHECK_THROW(max + max, std::exception);
+    BOOST_CHECK_NO_THROW(max - max);
+
+    using uf = safe_float<dd, policy::check_underflow>;
+    BOOST_CHECK_THROW(uf(std::numeric_limits<dd>::min()) / uf(dd(2)), std::exception);
+    BOOST_CHECK_NO_THROW(uf(std::numeric_limits<dd>::min()) * uf(dd(2)));
+
+    using ir = safe_float<dd, policy::check_invalid_result>;
+    ir const inf(std::numeric_limits<dd>::infinity());
+    BOOST_CHECK_THROW(inf - inf, std::exception);
+    BOOST_CHECK_NO_THROW(inf + inf);
+
+    using dz = safe_float<dd, policy::check_division_by_zero>;
+    BOOST_CHECK_THROW(dz(dd(1)) / dz(dd(0)), std::exception);
+
+    try
+    {
+        max * max;
+        BOOST_ERROR("An exception is supposed to be thrown");
+    }
+    catch (policy::arithmetic_failure<dd>& e)
+    {
+        BOOST_CHECK(e.descriptor().category == policy::failure_category::overflow);
+    }
+
+    BOOST_CHECK_EQUAL(std::numeric_limits<sf>::digits, 104);
+    std::istringstream in("1e400");
+    sf read;
+    BOOST_CHECK_THROW(in >> read, std::exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
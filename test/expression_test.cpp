@@ -0,0 +1,83 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#define BOOST_SAFE_FLOAT_EXPRESSION_TEMPLATES
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/convenience.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+// handler keeping every message reported and continuing
+struct keep_messages
+{
+    inline static std::vector<std::string> messages;
+    void report_failure(const std::string& s) { messages.push_back(s); }
+};
+
+template<class FP>
+using logged_float = safe_float<FP, policy::check_addition_overflow, keep_messages>;
+
+/**
+  This test suite checks the expressions built by the operators when BOOST_SAFE_FLOAT_EXPRESSION_TEMPLATES is defined
+  are evaluated and reported as the eager operators are.
+  */
+BOOST_AUTO_TEST_SUITE( safe_float_expression_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_expression_value, FPT, test_types){
+    safe_float<FPT> a(FPT(2)), b(FPT(3)), c(FPT(4)), d(FPT(5)), e(FPT(6));
+    safe_float<FPT> r = a*b + c*d - e;
+    BOOST_CHECK(r.get_stored_value() == 20);
+    r = (a + b) / (d - c);
+    BOOST_CHECK(r.get_stored_value() == 5);
+    r = -(a*b) + e;
+    BOOST_CHECK(r.get_stored_value() == 0);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_expression_failure, FPT, test_types){
+    safe_float<FPT> const max(std::numeric_limits<FPT>::max()), two(FPT(2)), zero(FPT(0));
+    safe_float<FPT> r(FPT(1));
+    BOOST_CHECK_THROW(r = max*two - max, std::runtime_error);
+    BOOST_CHECK(r.get_stored_value() == 1);
+    BOOST_CHECK_THROW(r = two + two/zero, std::runtime_error);
+    // the message is the one the compound operators give
+    std::string message;
+    try
+    {
+        r = two + max*two;
+    }
+    catch (const std::exception& e)
+    {
+        message = e.what();
+    }
+    safe_float<FPT> eager(max);
+    BOOST_CHECK_EXCEPTION(eager *= two, std::runtime_error,
+                          [&](const std::runtime_error& e) { return message == e.what(); });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_expression_failing_node, FPT, test_types){
+    logged_float<FPT> const max(std::numeric_limits<FPT>::max()), one(FPT(1));
+    keep_messages::messages.clear();
+    logged_float<FPT> r = one + one + (max + max);
+    // only the failing node reports, once
+    BOOST_REQUIRE_EQUAL(keep_messages::messages.size(), 1u);
+    BOOST_CHECK_EQUAL(keep_messages::messages[0], "Overflow to infinite on addition operation");
+    BOOST_CHECK(r.get_stored_value() == std::numeric_limits<FPT>::infinity());
+    keep_messages::messages.clear();
+    r = one + one + one;
+    BOOST_CHECK(keep_messages::messages.empty());
+    BOOST_CHECK(r.get_stored_value() == 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
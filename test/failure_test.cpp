@@ -0,0 +1,126 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <cstdlib>
+#include <limits>
+#include <new>
+
+#include <boost/safe_float.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+// counts the allocations done by the thread
+static thread_local long allocations = 0;
+
+void* operator new(std::size_t size)
+{
+    ++allocations;
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+// handler logging the failures and continuing, without building any message
+template<class FP>
+struct keep_failures
+{
+    static constexpr int capacity = 4;
+    policy::failure<FP> failures[capacity];
+    int count = 0;
+    int messages = 0;
+
+    void report_failure(const policy::failure<FP>& f)
+    {
+        if (count < capacity) failures[count] = f;
+        ++count;
+    }
+    void report_failure(const std::string&) { ++messages; }
+};
+
+template<class FP>
+keep_failures<FP> failure_log;
+
+template<class FP>
+struct log_and_continue
+{
+    void report_failure(const policy::failure<FP>& f) { failure_log<FP>.report_failure(f); }
+    void report_failure(const std::string& s) { failure_log<FP>.report_failure(s); }
+};
+
+/**
+  This test suite checks the failure descriptors given to the handlers.
+  */
+BOOST_AUTO_TEST_SUITE( safe_float_failure_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_failure_descriptor, FPT, test_types){
+    using overflow_float = safe_float<FPT, policy::check_overflow, log_and_continue<FPT>>;
+    using zero_float = safe_float<FPT, policy::check_division_by_zero, log_and_continue<FPT>>;
+    failure_log<FPT> = {};
+    overflow_float const max(std::numeric_limits<FPT>::max());
+    zero_float const zero(FPT(0)), one(FPT(1));
+
+    long const before = allocations;
+    overflow_float a = max + max;
+    zero_float b = one / zero;
+    BOOST_CHECK_EQUAL(allocations, before);
+
+    BOOST_REQUIRE_EQUAL(failure_log<FPT>.count, 2);
+    BOOST_CHECK_EQUAL(failure_log<FPT>.messages, 0);
+    auto const& overflow = failure_log<FPT>.failures[0];
+    BOOST_CHECK(overflow.operation == policy::operation_kind::addition);
+    BOOST_CHECK(overflow.category == policy::failure_category::overflow);
+    BOOST_CHECK(overflow.has_result);
+    BOOST_CHECK(overflow.lhs == std::numeric_limits<FPT>::max());
+    BOOST_CHECK(overflow.rhs == std::numeric_limits<FPT>::max());
+    BOOST_CHECK(overflow.result == a.get_stored_value());
+    BOOST_CHECK_EQUAL(overflow.message(), "Overflow to infinite on addition operation");
+
+    auto const& division = failure_log<FPT>.failures[1];
+    BOOST_CHECK(division.operation == policy::operation_kind::division);
+    BOOST_CHECK(division.category == policy::failure_category::division_by_zero);
+    BOOST_CHECK(division.lhs == 1);
+    BOOST_CHECK(division.rhs == 0);
+    BOOST_CHECK_EQUAL(division.message(), "Division by zero");
+    (void)b;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_failure_throw, FPT, test_types){
+    safe_float<FPT, policy::check_overflow> max(std::numeric_limits<FPT>::max());
+    try
+    {
+        max * max;
+        BOOST_ERROR("An exception is supposed to be thrown");
+    }
+    catch (policy::arithmetic_failure<FPT>& e)
+    {
+        BOOST_CHECK_EQUAL(e.what(), "Overflow to infinite on multiplication operation");
+        BOOST_CHECK(e.descriptor().operation == policy::operation_kind::multiplication);
+        BOOST_CHECK(e.descriptor().category == policy::failure_category::overflow);
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_composed_failure_message, FPT, test_types){
+    using check = policy::compose_check<policy::check_division_by_zero, policy::check_addition_overflow>::policy<FPT>;
+    check c;
+    // read and written through volatiles, the division is computed between the checks and raises FE_DIVBYZERO
+    volatile FPT one = 1, zero = 0;
+    FPT const lhs = one, rhs = zero;
+    // the composed check says which of its policies failed
+    bool const pre_passed = c.pre_division_check(lhs, rhs);
+    volatile FPT quotient = one / zero;
+    if (pre_passed && c.post_division_check(lhs, rhs, FPT(quotient)))
+        BOOST_ERROR("The division by zero is supposed to fail");
+    BOOST_CHECK_EQUAL(c.division_failure_message(), "Division by zero");
+    BOOST_CHECK(c.division_failed_category() == policy::failure_category::division_by_zero);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
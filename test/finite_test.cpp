@@ -0,0 +1,125 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <limits>
+#include <string>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/convenience.hpp>
+#include <boost/safe_float/simd.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+using simd_types=boost::mpl::list<
+    float, double
+>;
+
+using namespace boost::safe_float;
+
+template<class FP>
+using finite_float = safe_float<FP, policy::check_finite>;
+
+// category reported for lhs op rhs, unknown when the operation passes
+template<class FP, class OPERATION>
+policy::failure_category failed_category(OPERATION operation)
+{
+    try
+    {
+        operation();
+    }
+    catch (policy::arithmetic_failure<FP>& e)
+    {
+        return e.descriptor().category;
+    }
+    return policy::failure_category::unknown;
+}
+
+// handler taking only messages, the category diagnosed is in them
+struct keep_message : policy::on_fail_policy
+{
+    inline static std::string message;
+    void report_failure(const std::string& s) { message = s; }
+};
+
+/**
+  This test suite checks the check_finite policies and the diagnosis of their failures.
+  */
+BOOST_AUTO_TEST_SUITE( safe_float_finite_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_finite_passing_operations, FPT, test_types){
+    finite_float<FPT> max(std::numeric_limits<FPT>::max()), min(std::numeric_limits<FPT>::min()), three(FPT(3));
+    BOOST_CHECK_NO_THROW(max + max * finite_float<FPT>(FPT(-1)));
+    BOOST_CHECK_NO_THROW(max - max);
+    BOOST_CHECK_NO_THROW(min * min);
+    BOOST_CHECK_NO_THROW(min / three);
+    BOOST_CHECK_NO_THROW(finite_float<FPT>(FPT(0)) / three);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_finite_diagnosis, FPT, test_types){
+    using category = policy::failure_category;
+    FPT const inf = std::numeric_limits<FPT>::infinity();
+    finite_float<FPT> max(std::numeric_limits<FPT>::max()), zero(FPT(0)), one(FPT(1));
+    BOOST_CHECK(failed_category<FPT>([&] { max + max; }) == category::overflow);
+    BOOST_CHECK(failed_category<FPT>([&] { max * max; }) == category::overflow);
+    BOOST_CHECK(failed_category<FPT>([&] { max / finite_float<FPT>(FPT(0.5)); }) == category::overflow);
+    BOOST_CHECK(failed_category<FPT>([&] { one / zero; }) == category::division_by_zero);
+    BOOST_CHECK(failed_category<FPT>([&] { zero / zero; }) == category::invalid_result);
+    BOOST_CHECK(failed_category<FPT>([&] { finite_float<FPT>(inf) - one; }) == category::non_finite_operand);
+    // the quotient is finite, the divisor is not
+    BOOST_CHECK(failed_category<FPT>([&] { one / finite_float<FPT>(inf); }) == category::non_finite_operand);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_finite_messages, FPT, test_types){
+    finite_float<FPT> max(std::numeric_limits<FPT>::max()), zero(FPT(0)), one(FPT(1));
+    try
+    {
+        max * max;
+        BOOST_ERROR("An exception is supposed to be thrown");
+    }
+    catch (policy::arithmetic_failure<FPT>& e)
+    {
+        BOOST_CHECK_EQUAL(e.what(), "Overflow to infinite on multiplication operation");
+    }
+    try
+    {
+        one / zero;
+        BOOST_ERROR("An exception is supposed to be thrown");
+    }
+    catch (policy::arithmetic_failure<FPT>& e)
+    {
+        BOOST_CHECK_EQUAL(e.what(), "Division by zero");
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_finite_string_messages, FPT, test_types){
+    using message_float = safe_float<FPT, policy::check_finite, keep_message>;
+    message_float const max(std::numeric_limits<FPT>::max()), zero(FPT(0)), one(FPT(1));
+    max * max;
+    BOOST_CHECK_EQUAL(keep_message::message, "Overflow to infinite on multiplication operation");
+    zero / zero;
+    BOOST_CHECK_EQUAL(keep_message::message, "Invalid result from arithmetic operation obtained");
+    // composed with a policy checking the same operation
+    using composed_float = safe_float<FPT, policy::compose_check<policy::check_division_finite,
+                                                                 policy::check_division_by_zero>::policy, keep_message>;
+    keep_message::message.clear();
+    composed_float(std::numeric_limits<FPT>::max()) / composed_float(FPT(0.5));
+    BOOST_CHECK_EQUAL(keep_message::message, "Overflow to infinite on division operation");
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_finite_lanes, FPT, simd_types){
+    using simd = safe_simd<FPT, 4, policy::check_finite>;
+    FPT const max = std::numeric_limits<FPT>::max();
+    FPT const a_values[] = {1, max, 0, 1}, b_values[] = {2, 0.5, 0, std::numeric_limits<FPT>::infinity()};
+    auto const a = simd::load(a_values);
+    auto const b = simd::load(b_values);
+    BOOST_CHECK_EXCEPTION(a / b, policy::lane_failure,
+                          [](const policy::lane_failure& e) { return e.lanes() == 0xeu; });
+    BOOST_CHECK_EXCEPTION(a * b, policy::lane_failure,
+                          [](const policy::lane_failure& e) { return e.lanes() == 0x8u; });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,97 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <cmath>
+#include <limits>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/convenience.hpp>
+#include <boost/safe_float/simd.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+using simd_types=boost::mpl::list<
+    float, double
+>;
+
+using namespace boost::safe_float;
+
+template<class FP>
+using eft = safe_float<FP, policy::check_inexact_rounding_eft>;
+
+/**
+  This test suite checks the inexact policies using error-free transformations, including the cases the round trip
+  checks of check_*_inexact miss.
+  */
+BOOST_AUTO_TEST_SUITE( safe_float_inexact_eft_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_inexact_eft_round_trip_misses, FPT, test_types){
+    // (1 + eps)^2 = 1 + 2 eps + eps^2 rounds to 1 + 2 eps, dividing it back gives 1 + eps
+    FPT a = 1 + std::numeric_limits<FPT>::epsilon();
+    BOOST_CHECK((a * a) / a == a);
+    BOOST_CHECK_THROW(eft<FPT>(a) * eft<FPT>(a), std::exception);
+
+    // 1 / 3 rounded multiplied back by 3 gives 1
+    FPT b = 3;
+    BOOST_CHECK((1 / b) * b == 1);
+    BOOST_CHECK_THROW(eft<FPT>(FPT(1)) / eft<FPT>(b), std::exception);
+
+    // 1 + eps / 4 rounds to 1
+    BOOST_CHECK_THROW(eft<FPT>(FPT(1)) + eft<FPT>(a - 1) / eft<FPT>(FPT(4)), std::exception);
+    BOOST_CHECK_THROW(eft<FPT>(FPT(1)) - eft<FPT>(std::numeric_limits<FPT>::epsilon() / 4), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_inexact_eft_exact_operations, FPT, test_types){
+    FPT const inf = std::numeric_limits<FPT>::infinity();
+    eft<FPT> three(FPT(3)), half(FPT(0.5)), big(std::numeric_limits<FPT>::max());
+    BOOST_CHECK_NO_THROW(three + half);
+    BOOST_CHECK_NO_THROW(big - big);
+    BOOST_CHECK_NO_THROW(three * half);
+    BOOST_CHECK_NO_THROW(eft<FPT>(FPT(0.75)) / three);
+    BOOST_CHECK_NO_THROW(eft<FPT>(inf) + three);
+    BOOST_CHECK_NO_THROW(three / eft<FPT>(inf));
+    BOOST_CHECK_NO_THROW(big * eft<FPT>(FPT(1)));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_inexact_eft_overflow, FPT, test_types){
+    eft<FPT> big(std::numeric_limits<FPT>::max());
+    BOOST_CHECK_THROW(big + big, std::exception);
+    BOOST_CHECK_THROW(big * eft<FPT>(FPT(2)), std::exception);
+    BOOST_CHECK_THROW(big / eft<FPT>(FPT(0.5)), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_inexact_eft_subnormals, FPT, test_types){
+    eft<FPT> min(std::numeric_limits<FPT>::min()), tiny(std::numeric_limits<FPT>::denorm_min());
+    eft<FPT> half(FPT(0.5)), three(FPT(3));
+    // subnormal results are exact when they have the bits of the exact value
+    BOOST_CHECK_NO_THROW(min * half);
+    BOOST_CHECK_NO_THROW(min / eft<FPT>(FPT(4)));
+    BOOST_CHECK_NO_THROW(tiny * three);
+    BOOST_CHECK_NO_THROW(tiny + tiny);
+    // and rounded below the smallest subnormal otherwise
+    BOOST_CHECK_THROW(tiny * half, std::exception);
+    BOOST_CHECK_THROW(tiny * three * half, std::exception);
+    BOOST_CHECK_THROW(tiny / three, std::exception);
+    BOOST_CHECK_THROW(min * eft<FPT>(std::numeric_limits<FPT>::epsilon() / 3), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_inexact_eft_lanes, FPT, simd_types){
+    using simd = safe_simd<FPT, 4, policy::check_inexact_rounding_eft>;
+    FPT const a_values[] = {1, 1, 3, std::numeric_limits<FPT>::denorm_min()}, b_values[] = {4, 3, 2, 2};
+    auto const a = simd::load(a_values);
+    auto const b = simd::load(b_values);
+    BOOST_CHECK_EXCEPTION(a / b, policy::lane_failure,
+                          [](const policy::lane_failure& e) { return e.lanes() == 0xau; });
+    BOOST_CHECK_NO_THROW(a * b);
+    // 1 + eps / 4 and 1 + 3 eps / 4 are rounded, 1 + eps is exact
+    FPT const eps = std::numeric_limits<FPT>::epsilon();
+    FPT const c_values[] = {eps / 4, eps / 4, 3 * eps / 4, eps};
+    BOOST_CHECK_EXCEPTION(simd(FPT(1)) + simd::load(c_values), policy::lane_failure,
+                          [](const policy::lane_failure& e) { return e.lanes() == 0x7u; });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
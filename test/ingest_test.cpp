@@ -0,0 +1,145 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/ingest.hpp>
+
+using namespace boost::safe_float;
+
+// handler recording the failures with their coordinates
+struct recording_handler
+{
+    std::vector<std::string>* failures;
+    void report_failure(const std::string& message) { failures->push_back(message); }
+    void report_parse_failure(const std::string& message, std::size_t row, std::size_t column)
+    {
+        failures->push_back(message + " " + std::to_string(row) + ":" + std::to_string(column));
+    }
+};
+
+/**
+  This test suite checks the parsing of delimited text into columns of safe_float and the failures reported.
+  */
+BOOST_AUTO_TEST_SUITE( safe_float_ingest_test_suite )
+
+BOOST_AUTO_TEST_CASE( safe_float_ingest_csv ){
+    std::string const text = "x,y\n1.5,-2\n 0.25 , 1e3\r\n4,8";
+    std::vector<safe_float<double>> x(3), y(3);
+    safe_float<double>* const columns[] = {x.data(), y.data()};
+    ingest::options opts;
+    opts.skip_rows = 1;
+    BOOST_CHECK_EQUAL(ingest::count_rows(text.data(), text.data() + text.size(), opts), 3u);
+    BOOST_CHECK_EQUAL(ingest::read_columns(text.data(), text.data() + text.size(), columns, 2, 3, opts), 3u);
+    BOOST_CHECK_EQUAL(x[0].get_stored_value(), 1.5);
+    BOOST_CHECK_EQUAL(y[0].get_stored_value(), -2.);
+    BOOST_CHECK_EQUAL(x[1].get_stored_value(), 0.25);
+    BOOST_CHECK_EQUAL(y[1].get_stored_value(), 1e3);
+    BOOST_CHECK_EQUAL(x[2].get_stored_value(), 4.);
+    BOOST_CHECK_EQUAL(y[2].get_stored_value(), 8.);
+}
+
+BOOST_AUTO_TEST_CASE( safe_float_ingest_blanks ){
+    std::string const text = "  1\t 2   3\n4 5 6\n";
+    std::vector<safe_float<float>> a(2), b(2), c(2);
+    safe_float<float>* const columns[] = {a.data(), b.data(), c.data()};
+    ingest::options opts;
+    opts.delimiter = ' ';
+    BOOST_CHECK_EQUAL(ingest::read_columns(text.data(), text.data() + text.size(), columns, 3, 2, opts), 2u);
+    BOOST_CHECK_EQUAL(b[0].get_stored_value(), 2.f);
+    BOOST_CHECK_EQUAL(c[1].get_stored_value(), 6.f);
+}
+
+BOOST_AUTO_TEST_CASE( safe_float_ingest_failures ){
+    std::string const text = "1,2\nx,3\n4,1e999\n5\n6,7,8\n,9\n";
+    std::vector<safe_float<double>> a(6), b(6);
+    safe_float<double>* const columns[] = {a.data(), b.data()};
+    std::vector<std::string> failures;
+    auto const rows = ingest::read_columns(text.data(), text.data() + text.size(), columns, 2, 6, ingest::options{},
+                                           recording_handler{&failures});
+    BOOST_CHECK_EQUAL(rows, 6u);
+    std::vector<std::string> const expected = {
+        "Not a valid floating point number 1:0", "Floating point number out of range 2:1", "Missing value 3:1",
+        "Too many values 4:2", "Missing value 5:0"};
+    BOOST_CHECK_EQUAL_COLLECTIONS(failures.begin(), failures.end(), expected.begin(), expected.end());
+    // the values around the failures are read
+    BOOST_CHECK_EQUAL(b[1].get_stored_value(), 3.);
+    BOOST_CHECK_EQUAL(a[4].get_stored_value(), 6.);
+    BOOST_CHECK_EQUAL(b[5].get_stored_value(), 9.);
+    // the default handler throws, with the coordinates in the message
+    try
+    {
+        ingest::read_columns(text.data(), text.data() + text.size(), columns, 2, 6);
+        BOOST_ERROR("An exception is supposed to be thrown");
+    }
+    catch (std::exception& e)
+    {
+        BOOST_CHECK_EQUAL(e.what(), "Not a valid floating point number (row 1, column 0)");
+    }
+    BOOST_CHECK_THROW(ingest::read_columns(text.data(), text.data() + 4, columns, 2, 0), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE( safe_float_ingest_non_finite ){
+    // the values parsed that the safe_float doesn't hold are reported and left unchanged
+    std::string const text = "nan,inf\n-inf,1\n";
+    std::vector<safe_float<double>> a(2, safe_float<double>(0.)), b(2, safe_float<double>(0.));
+    safe_float<double>* const columns[] = {a.data(), b.data()};
+    std::vector<std::string> failures;
+    auto const rows = ingest::read_columns(text.data(), text.data() + text.size(), columns, 2, 2, ingest::options{},
+                                           recording_handler{&failures});
+    BOOST_CHECK_EQUAL(rows, 2u);
+    std::vector<std::string> const expected = {"NaN value 0:0", "Infinite value 0:1", "Infinite value 1:0"};
+    BOOST_CHECK_EQUAL_COLLECTIONS(failures.begin(), failures.end(), expected.begin(), expected.end());
+    BOOST_CHECK_EQUAL(a[0].get_stored_value(), 0.);
+    BOOST_CHECK_EQUAL(b[0].get_stored_value(), 0.);
+    BOOST_CHECK_EQUAL(a[1].get_stored_value(), 0.);
+    BOOST_CHECK_EQUAL(b[1].get_stored_value(), 1.);
+}
+
+BOOST_AUTO_TEST_CASE( safe_float_ingest_threads ){
+    std::string text;
+    std::size_t const size = 200000;
+    for (std::size_t i = 0; i < size; ++i) text += std::to_string(i) + ".5," + std::to_string(i % 7) + "\n";
+    std::vector<safe_float<double>> a(size), b(size);
+    safe_float<double>* const columns[] = {a.data(), b.data()};
+    ingest::options opts;
+    opts.threads = 4;
+    BOOST_CHECK_EQUAL(ingest::read_columns(text.data(), text.data() + text.size(), columns, 2, size, opts), size);
+    bool same = true;
+    for (std::size_t i = 0; i < size; ++i)
+        same &= a[i].get_stored_value() == double(i) + 0.5 and b[i].get_stored_value() == double(i % 7);
+    BOOST_CHECK(same);
+    // the failures of the chunks are reported in the order of the rows
+    text[text.size() - 4] = 'x';
+    text[6] = 'x';
+    std::vector<std::string> failures;
+    ingest::read_columns(text.data(), text.data() + text.size(), columns, 2, size, opts, recording_handler{&failures});
+    BOOST_REQUIRE_EQUAL(failures.size(), 2u);
+    BOOST_CHECK_EQUAL(failures[0], "Not a valid floating point number 1:0");
+    BOOST_CHECK_EQUAL(failures[1], "Not a valid floating point number " + std::to_string(size - 1) + ":0");
+}
+
+#ifdef BOOST_SAFE_FLOAT_HAS_MAPPED_FILE
+BOOST_AUTO_TEST_CASE( safe_float_ingest_mapped_file ){
+    char const* const path = "safe_float_ingest_test.csv";
+    std::FILE* file = std::fopen(path, "w");
+    BOOST_REQUIRE(file);
+    std::fputs("0.5,1\n2,4\n", file);
+    std::fclose(file);
+    std::vector<safe_float<double>> a(2), b(2);
+    safe_float<double>* const columns[] = {a.data(), b.data()};
+    {
+        ingest::mapped_file const mapped(path);
+        BOOST_CHECK_EQUAL(ingest::read_columns(mapped.begin(), mapped.end(), columns, 2, 2), 2u);
+    }
+    std::remove(path);
+    BOOST_CHECK_EQUAL(a[0].get_stored_value(), 0.5);
+    BOOST_CHECK_EQUAL(b[1].get_stored_value(), 4.);
+    BOOST_CHECK_THROW(ingest::mapped_file("safe_float_ingest_test_missing.csv"), std::system_error);
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,147 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/convenience.hpp>
+#include <boost/safe_float/linalg.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+// small integers, the products and their sums are exact in any order. There is no 0: the inexact check of the
+// multiplication divides the product by an operand.
+template<class SF>
+std::vector<SF> integers(std::size_t size, int seed)
+{
+    std::vector<SF> values;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        int const v = int((i * 7 + seed) % 9) + 1;
+        values.emplace_back(typename SF::value_type(i % 3 ? v : -v));
+    }
+    return values;
+}
+
+/**
+  This test suite checks the linear algebra kernels against the loops of the operators of safe_float and the index of
+  the failures they report.
+  */
+BOOST_AUTO_TEST_SUITE( safe_float_linalg_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_linalg_values, FPT, test_types){
+    using sf = safe_float<FPT>;
+    auto const x = integers<sf>(1003, 1), y = integers<sf>(1003, 2);
+    sf expected(FPT(0));
+    for (std::size_t i = 0; i < x.size(); ++i) expected += x[i] * y[i];
+    BOOST_CHECK_EQUAL(linalg::dot(x.data(), y.data(), x.size()).get_stored_value(), expected.get_stored_value());
+
+    auto axpy = y;
+    linalg::axpy(sf(FPT(3)), x.data(), axpy.data(), x.size());
+    for (std::size_t i = 0; i < x.size(); ++i)
+        BOOST_CHECK_EQUAL(axpy[i].get_stored_value(), (sf(FPT(3)) * x[i] + y[i]).get_stored_value());
+
+    // sizes crossing the blocks, with columns left after the vectors
+    for (auto const [m, k, n] : {std::array<std::size_t, 3>{37, 131, 1}, std::array<std::size_t, 3>{66, 130, 263}})
+    {
+        auto const a = integers<sf>(m * k, 3), b = integers<sf>(k * n, 4), v = integers<sf>(k, 5);
+        std::vector<sf> c(m * n), w(m);
+        linalg::gemv(a.data(), v.data(), w.data(), m, k);
+        linalg::gemm(a.data(), b.data(), c.data(), m, k, n);
+        for (std::size_t i = 0; i < m; ++i)
+        {
+            sf row(FPT(0));
+            for (std::size_t p = 0; p < k; ++p) row += a[i * k + p] * v[p];
+            BOOST_CHECK_EQUAL(w[i].get_stored_value(), row.get_stored_value());
+            // the FP products of small integers are exact as the checked ones
+            for (std::size_t j = 0; j < n; ++j)
+            {
+                FPT element = 0;
+                for (std::size_t p = 0; p < k; ++p)
+                    element += a[i * k + p].get_stored_value() * b[p * n + j].get_stored_value();
+                BOOST_CHECK_EQUAL(c[i * n + j].get_stored_value(), element);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_linalg_failing_index, FPT, test_types){
+    using sf = safe_float<FPT, policy::check_overflow>;
+    FPT const max = std::numeric_limits<FPT>::max();
+    auto const index_of_failure = [](auto&& kernel) -> std::size_t {
+        try
+        {
+            kernel();
+        }
+        catch (policy::batch_failure& e)
+        {
+            return e.index();
+        }
+        return std::size_t(-1);
+    };
+
+    auto x = integers<sf>(5000, 1);
+    auto y = integers<sf>(5000, 2);
+    x[2517] = sf(max);
+    y[2517] = sf(FPT(2));
+    BOOST_CHECK_EQUAL(index_of_failure([&] { linalg::dot(x.data(), y.data(), x.size()); }), 2517u);
+    // inexact product
+    auto const exact_x = integers<safe_float<FPT>>(5000, 1), exact_y = integers<safe_float<FPT>>(5000, 2);
+    auto inexact_x = exact_x;
+    inexact_x[4001] = safe_float<FPT>(FPT(0.1));
+    BOOST_CHECK_NO_THROW(linalg::dot(exact_x.data(), exact_y.data(), exact_x.size()));
+    BOOST_CHECK_EQUAL(index_of_failure([&] { linalg::dot(inexact_x.data(), exact_y.data(), x.size()); }), 4001u);
+    // the tiles before the failing one are updated, not the following ones
+    auto z = y;
+    x[3001] = sf(max);
+    x[2517] = sf(FPT(1));
+    z[3001] = sf(max);
+    BOOST_CHECK_EQUAL(index_of_failure([&] { linalg::axpy(sf(FPT(2)), x.data(), z.data(), x.size()); }), 3001u);
+    BOOST_CHECK_EQUAL(z[0].get_stored_value(), (sf(FPT(2)) * x[0] + y[0]).get_stored_value());
+    BOOST_CHECK_EQUAL(z[4999].get_stored_value(), y[4999].get_stored_value());
+
+    std::size_t const m = 66, k = 130, n = 263;
+    auto a = integers<sf>(m * k, 3), b = integers<sf>(k * n, 4);
+    std::vector<sf> v(k, sf(FPT(1))), w(m), c(m * n);
+    // A[43][10] * B[10][j] only overflows for j, in the vectors and in the last columns
+    a[43 * k + 10] = sf(max);
+    for (std::size_t j : {std::size_t(130), n - 1})
+    {
+        for (std::size_t i = 0; i < n; ++i) b[10 * n + i] = sf(FPT(i == j ? 3 : 1));
+        BOOST_CHECK_EQUAL(index_of_failure([&] { linalg::gemm(a.data(), b.data(), c.data(), m, k, n); }), 43 * n + j);
+    }
+    v[10] = sf(FPT(2));
+    BOOST_CHECK_EQUAL(index_of_failure([&] { linalg::gemv(a.data(), v.data(), w.data(), m, k); }), 43u);
+}
+
+// handler without report_batch_failure gets the index in the message
+struct keep_message : policy::on_fail_policy
+{
+    std::string* last;
+    void report_failure(const std::string& s) { *last = s; }
+};
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_linalg_plain_handler, FPT, test_types){
+    using sf = safe_float<FPT, policy::check_overflow>;
+    std::vector<sf> x(40, sf(FPT(1))), y(40, sf(FPT(2)));
+    x[33] = sf(std::numeric_limits<FPT>::max());
+    std::string message;
+    keep_message handler;
+    handler.last = &message;
+    // the sum is computed with the infinite product
+    BOOST_CHECK(std::isinf(linalg::dot(x.data(), y.data(), x.size(), handler).get_stored_value()));
+    BOOST_CHECK_EQUAL(message, "Overflow to infinite on multiplication operation (element 33)");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
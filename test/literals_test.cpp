@@ -0,0 +1,85 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <limits>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/convenience.hpp>
+#include <boost/safe_float/literals.hpp>
+
+using namespace boost::safe_float;
+using namespace boost::safe_float::literals;
+
+using exact_double = safe_float<double, policy::check_inexact_rounding_eft>;
+using finite_float = safe_float<float, policy::check_finite>;
+using finite_double = safe_float<double, policy::check_finite>;
+using finite_long_double = safe_float<long double, policy::check_finite>;
+
+BOOST_SAFE_FLOAT_LITERAL(_exact, exact_double)
+// the rounded literals are accepted without the inexact checks
+BOOST_SAFE_FLOAT_LITERAL(_ff, finite_float)
+BOOST_SAFE_FLOAT_LITERAL(_fd, finite_double)
+BOOST_SAFE_FLOAT_LITERAL(_fld, finite_long_double)
+
+// the literal as the compiler rounds it, and whether it is exact
+template<typename FP, char... STR>
+constexpr detail::rounded_literal<FP> rounded()
+{
+    return detail::parse_float_literal<FP, STR...>();
+}
+
+/**
+  This test suite checks the literals are rounded as the compiler rounds the floating point literals, and rejected
+  when inexact for the policies checking the inexact operations.
+  */
+BOOST_AUTO_TEST_SUITE( safe_float_literals_test_suite )
+
+BOOST_AUTO_TEST_CASE( safe_float_literals_default_policy ){
+    // safe_float checks the inexact operations by default, its literals are exact
+    static_assert((0.5_sd).get_stored_value() == 0.5, "constexpr literal");
+    BOOST_CHECK_EQUAL((0.5_sf).get_stored_value(), 0.5f);
+    BOOST_CHECK_EQUAL((1e22_sd).get_stored_value(), 1e22);
+    BOOST_CHECK_EQUAL((0.375e3_sld).get_stored_value(), 375.0L);
+    BOOST_CHECK_EQUAL((0x1p-3_sd).get_stored_value(), 0.125);
+    BOOST_CHECK_EQUAL((0e999_sd).get_stored_value(), 0.);
+}
+
+BOOST_AUTO_TEST_CASE( safe_float_literals_rounding ){
+    BOOST_CHECK_EQUAL((0.1_fd).get_stored_value(), 0.1);
+    BOOST_CHECK_EQUAL((1e23_fd).get_stored_value(), 1e23);
+    BOOST_CHECK_EQUAL((0.30000000000000004_fd).get_stored_value(), 0.30000000000000004);
+    BOOST_CHECK_EQUAL((2.2250738585072011e-308_fd).get_stored_value(), 2.2250738585072011e-308);
+    BOOST_CHECK_EQUAL((4.9e-324_fd).get_stored_value(), 4.9e-324);
+    BOOST_CHECK_EQUAL((2.4703282292062328e-324_fd).get_stored_value(), 2.4703282292062328e-324);
+    BOOST_CHECK_EQUAL((1.7976931348623157e308_fd).get_stored_value(), 1.7976931348623157e308);
+    BOOST_CHECK_EQUAL((9007199254740993_fd).get_stored_value(), 9007199254740993.);
+    BOOST_CHECK_EQUAL((123456789012345678901234567890.123456789e-10_fd).get_stored_value(),
+                      123456789012345678901234567890.123456789e-10);
+    BOOST_CHECK_EQUAL((1e-400_fd).get_stored_value(), 0.);
+    BOOST_CHECK_EQUAL((0.1_ff).get_stored_value(), 0.1f);
+    BOOST_CHECK_EQUAL((1.17549435e-38_ff).get_stored_value(), 1.17549435e-38f);
+    BOOST_CHECK_EQUAL((3.4028234e38_ff).get_stored_value(), 3.4028234e38f);
+    BOOST_CHECK_EQUAL((16777217_ff).get_stored_value(), 16777217.f);
+    BOOST_CHECK_EQUAL((0.1_fld).get_stored_value(), 0.1L);
+    BOOST_CHECK_EQUAL((3.14159265358979323846264338327950288_fld).get_stored_value(),
+                      3.14159265358979323846264338327950288L);
+    BOOST_CHECK_EQUAL((1e-4940_fld).get_stored_value(), 1e-4940L);
+}
+
+BOOST_AUTO_TEST_CASE( safe_float_literals_exactness ){
+    static_assert(rounded<double, '0', '.', '5'>().exact, "exact literal");
+    static_assert(rounded<double, '1', '2', '5', 'e', '-', '3'>().exact, "exact literal");
+    static_assert(rounded<double, '1', 'e', '2', '2'>().exact, "exact literal");
+    static_assert(!rounded<double, '1', 'e', '2', '3'>().exact, "rounded literal");
+    static_assert(!rounded<double, '0', '.', '1'>().exact, "rounded literal");
+    static_assert(rounded<float, '1', '6', '7', '7', '7', '2', '1', '6'>().exact, "exact literal");
+    static_assert(!rounded<float, '1', '6', '7', '7', '7', '2', '1', '7'>().exact, "rounded literal");
+    static_assert(rounded<double, '0', 'x', '1', 'p', '-', '2', '0', '0'>().exact, "exact literal");
+    static_assert(!rounded<float, '0', 'x', '1', 'p', '-', '2', '0', '0'>().exact, "rounded literal");
+    static_assert(rounded<float, '0', 'x', '1', 'p', '-', '1', '4', '9'>().exact, "exact literal");
+    BOOST_CHECK_EQUAL((0.375_exact).get_stored_value(), 0.375);
+    BOOST_CHECK(!detail::checks_inexact<finite_double>());
+    BOOST_CHECK(detail::checks_inexact<exact_double>());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -67,6 +67,21 @@ BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_comparison_operations, FPT, test_types
     BOOST_CHECK( min !=  max);
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_layout, FPT, test_types){
+    //check policies are stateless, a safe_float can then be used in place of the value it wraps
+    using number_type = safe_float<FPT>;
+    BOOST_CHECK_EQUAL(sizeof(number_type), sizeof(FPT));
+    BOOST_CHECK_EQUAL(alignof(number_type), alignof(FPT));
+    BOOST_CHECK(std::is_standard_layout<number_type>::value);
+    BOOST_CHECK(std::is_trivially_copyable<number_type>::value);
+    BOOST_CHECK_EQUAL(sizeof(safe_float<FPT, policy::check_overflow>), sizeof(FPT));
+    BOOST_CHECK(std::is_empty<policy::check_all<FPT>>::value);
+    BOOST_CHECK(has_fp_layout<number_type>::value);
+    BOOST_CHECK( ! has_fp_layout<FPT>::value);
+
+    number_type values[2] = {FPT(1), FPT(2)};
+    BOOST_CHECK_EQUAL(reinterpret_cast<FPT*>(values)[1], FPT(2));
+}
 
 BOOST_AUTO_TEST_SUITE_END()
 
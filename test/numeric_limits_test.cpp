@@ -72,8 +72,9 @@ BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_numeric_limits_basic_fp_types, FPT, te
     BOOST_CHECK(std::numeric_limits<number_type>::lowest().get_stored_value() == std::numeric_limits<FPT>::lowest());
     BOOST_CHECK(std::numeric_limits<number_type>::epsilon().get_stored_value() == std::numeric_limits<FPT>::epsilon());
     BOOST_CHECK(std::numeric_limits<number_type>::infinity().get_stored_value() == std::numeric_limits<FPT>::infinity());
-    BOOST_CHECK(std::numeric_limits<number_type>::quiet_NaN().get_stored_value() == std::numeric_limits<FPT>::quiet_NaN());
-    BOOST_CHECK(std::numeric_limits<number_type>::signaling_NaN().get_stored_value() == std::numeric_limits<FPT>::signaling_NaN());
+    //NaNs never compare equal
+    BOOST_CHECK(std::isnan(std::numeric_limits<number_type>::quiet_NaN().get_stored_value()));
+    BOOST_CHECK(std::isnan(std::numeric_limits<number_type>::signaling_NaN().get_stored_value()));
     BOOST_CHECK(std::numeric_limits<number_type>::denorm_min().get_stored_value() == std::numeric_limits<FPT>::denorm_min());
 }
 
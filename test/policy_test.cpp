@@ -34,24 +34,24 @@ BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_check_addition_overflow, FPT, test_typ
     policy::check_addition_overflow<FPT> check;
     //invalid precheck returns true on both checks
     BOOST_CHECK(check.pre_addition_check(std::numeric_limits<FPT>::infinity(), (FPT) 1));
-    BOOST_CHECK(check.post_addition_check(std::numeric_limits<FPT>::infinity()));
-    BOOST_CHECK(check.post_addition_check((FPT) 1));
+    BOOST_CHECK(check.post_addition_check(std::numeric_limits<FPT>::infinity(), (FPT) 1, std::numeric_limits<FPT>::infinity()));
+    BOOST_CHECK(check.post_addition_check(std::numeric_limits<FPT>::infinity(), (FPT) 1, (FPT) 1));
 
     BOOST_CHECK(check.pre_addition_check((FPT) 1, std::numeric_limits<FPT>::infinity()));
-    BOOST_CHECK(check.post_addition_check(std::numeric_limits<FPT>::infinity()));
-    BOOST_CHECK(check.post_addition_check((FPT) 1));
+    BOOST_CHECK(check.post_addition_check((FPT) 1, std::numeric_limits<FPT>::infinity(), std::numeric_limits<FPT>::infinity()));
+    BOOST_CHECK(check.post_addition_check((FPT) 1, std::numeric_limits<FPT>::infinity(), (FPT) 1));
 
     BOOST_CHECK(check.pre_addition_check(std::numeric_limits<FPT>::infinity(), std::numeric_limits<FPT>::infinity()));
-    BOOST_CHECK(check.post_addition_check(std::numeric_limits<FPT>::infinity()));
-    BOOST_CHECK(check.post_addition_check((FPT) 1));
+    BOOST_CHECK(check.post_addition_check(std::numeric_limits<FPT>::infinity(), std::numeric_limits<FPT>::infinity(), std::numeric_limits<FPT>::infinity()));
+    BOOST_CHECK(check.post_addition_check(std::numeric_limits<FPT>::infinity(), std::numeric_limits<FPT>::infinity(), (FPT) 1));
 
     //accept precheck & fail postcheck returns false on post check
     BOOST_CHECK(check.pre_addition_check((FPT) 1, (FPT) 1));
-    BOOST_CHECK(! check.post_addition_check(std::numeric_limits<FPT>::infinity()));
+    BOOST_CHECK(! check.post_addition_check((FPT) 1, (FPT) 1, std::numeric_limits<FPT>::infinity()));
 
     //accept precheck & accept postcheck
     BOOST_CHECK(check.pre_addition_check((FPT) 1, (FPT) 1));
-    BOOST_CHECK(check.post_addition_check((FPT) 2));
+    BOOST_CHECK(check.post_addition_check((FPT) 1, (FPT) 1, (FPT) 2));
 
     //check error message
     BOOST_CHECK_EQUAL(check.addition_failure_message(), std::string("Overflow to infinite on addition operation"));
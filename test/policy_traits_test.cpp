@@ -9,7 +9,9 @@
 #include <boost/mpl/vector.hpp>
 
 
+#include <cfenv>
 #include <cmath>
+#include <limits>
 
 #include <boost/safe_float.hpp>
 #include <boost/safe_float/convenience.hpp>
@@ -78,6 +80,39 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(safe_float_policy_traits_full_policy, FPT, test_ty
 
 BOOST_AUTO_TEST_SUITE_END() // policy_traits full policy
 
+BOOST_AUTO_TEST_SUITE(safe_float_policy_traits_fenv_flags_test_suite)
+BOOST_AUTO_TEST_CASE_TEMPLATE(safe_float_policy_traits_fenv_flags, FPT, test_types)
+{
+    using overflow = policy::policy_traits<FPT, policy::check_addition_overflow<FPT>>;
+    using base = policy::policy_traits<FPT, policy::check_policy<FPT>>;
+
+    // policies not relying on FE_* flags declare none
+    BOOST_CHECK_EQUAL(base::addition_fenv_flags(), 0);
+    BOOST_CHECK_EQUAL(overflow::subtraction_fenv_flags(), 0);
+#ifdef FENV_AVAILABLE
+    BOOST_CHECK_EQUAL(overflow::addition_fenv_flags(), FE_OVERFLOW);
+    BOOST_CHECK_EQUAL(policy::check_division_by_zero<FPT>::division_fenv_flags, FE_DIVBYZERO);
+#else
+    BOOST_CHECK_EQUAL(overflow::addition_fenv_flags(), 0);
+#endif
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(safe_float_policy_fenv_flags_backend, FPT, test_types)
+{
+    volatile FPT max = std::numeric_limits<FPT>::max();
+    BOOST_CHECK(policy::fenv_flags::clear<FPT>(FE_OVERFLOW | FE_INVALID));
+    BOOST_CHECK_EQUAL(policy::fenv_flags::test<FPT>(FE_OVERFLOW | FE_INVALID), 0);
+    volatile FPT result = max * max;
+#ifdef FENV_AVAILABLE
+    BOOST_CHECK_EQUAL(policy::fenv_flags::test<FPT>(FE_OVERFLOW | FE_INVALID), FE_OVERFLOW);
+    BOOST_CHECK(policy::fenv_flags::clear<FPT>(FE_OVERFLOW));
+#endif
+    BOOST_CHECK_EQUAL(policy::fenv_flags::test<FPT>(FE_OVERFLOW), 0);
+    (void)result;
+}
+
+BOOST_AUTO_TEST_SUITE_END() // policy_traits fenv flags
+
 BOOST_AUTO_TEST_SUITE(safe_float_policy_subset_test_suite)
 BOOST_AUTO_TEST_CASE_TEMPLATE(safe_float_policy_subset, FPT, test_types)
 {
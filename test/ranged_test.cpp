@@ -0,0 +1,114 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <limits>
+#include <type_traits>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/convenience.hpp>
+#include <boost/safe_float/ranged.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+/**
+  This test suite checks the ranges computed by the operators of ranged_safe_float and the checks they keep.
+  */
+BOOST_AUTO_TEST_SUITE( safe_float_ranged_test_suite )
+
+#if __cpp_nontype_template_args >= 201911L
+
+// check failing every multiplication and division, to see when the ranges keep it
+template<class FP>
+class always_overflowing : public policy::check_policy<FP> {
+public:
+    static constexpr policy::failure_category multiplication_failure_category = policy::failure_category::overflow;
+    static constexpr policy::failure_category division_failure_category = policy::failure_category::overflow;
+    bool post_multiplication_check(const FP&, const FP&, const FP&) { return false; }
+    bool post_division_check(const FP&, const FP&, const FP&) { return false; }
+};
+
+template<class FP, FP LO, FP HI>
+using overflow_checked = ranged_safe_float<FP, LO, HI, always_overflowing>;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_ranged_result_ranges, FPT, test_types){
+    using probability = ranged_safe_float<FPT, FPT(0), FPT(1)>;
+    using sensor = ranged_safe_float<FPT, FPT(-1000), FPT(1000)>;
+    using product = decltype(probability{} * probability{});
+    BOOST_CHECK_EQUAL(product::lower_bound, FPT(0));
+    BOOST_CHECK_EQUAL(product::upper_bound, FPT(1));
+    using scaled = decltype(sensor{} * probability{});
+    BOOST_CHECK_EQUAL(scaled::lower_bound, FPT(-1000));
+    BOOST_CHECK_EQUAL(scaled::upper_bound, FPT(1000));
+    using difference = decltype(sensor{} - probability{});
+    BOOST_CHECK_EQUAL(difference::lower_bound, FPT(-1001));
+    BOOST_CHECK_EQUAL(difference::upper_bound, FPT(1000));
+    using negated = decltype(-probability{});
+    BOOST_CHECK_EQUAL(negated::lower_bound, FPT(-1));
+    BOOST_CHECK_EQUAL(negated::upper_bound, FPT(0));
+    // the divisor range contains 0
+    using quotient = decltype(sensor{} / probability{});
+    BOOST_CHECK_EQUAL(quotient::upper_bound, std::numeric_limits<FPT>::infinity());
+    // the narrower ranges convert implicitly
+    BOOST_CHECK((std::is_convertible_v<probability, sensor>));
+    BOOST_CHECK((!std::is_convertible_v<sensor, probability>));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_ranged_values, FPT, test_types){
+    using probability = ranged_safe_float<FPT, FPT(0), FPT(1)>;
+    using sensor = ranged_safe_float<FPT, FPT(-1000), FPT(1000)>;
+    probability const half(FPT(0.5));
+    sensor const reading(FPT(300));
+    BOOST_CHECK_EQUAL((reading * half).get_stored_value(), FPT(150));
+    BOOST_CHECK_EQUAL((reading + half - half).get_stored_value(), FPT(300));
+    BOOST_CHECK_EQUAL((reading / sensor(FPT(-3))).get_stored_value(), FPT(-100));
+    BOOST_CHECK(half < reading);
+    BOOST_CHECK(sensor(half) == half);
+    BOOST_CHECK_THROW(probability(FPT(2)), std::exception);
+    BOOST_CHECK_THROW(probability{reading}, std::exception);
+    BOOST_CHECK_THROW(probability(std::numeric_limits<FPT>::quiet_NaN()), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_ranged_elided_checks, FPT, test_types){
+    constexpr FPT max = std::numeric_limits<FPT>::max();
+    overflow_checked<FPT, FPT(1), FPT(1000)> const reading(FPT(300));
+    overflow_checked<FPT, FPT(-1), FPT(1)> const factor(FPT(0.5));
+    // the result ranges are finite, the check isn't done
+    BOOST_CHECK_NO_THROW(reading * factor);
+    BOOST_CHECK_NO_THROW(factor / reading);
+    // they may overflow, the check fails
+    BOOST_CHECK_THROW(reading / factor, std::exception);
+    overflow_checked<FPT, FPT(0), max> const big(FPT(1));
+    BOOST_CHECK_THROW(big * reading, std::exception);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_ranged_kept_checks, FPT, test_types){
+    constexpr FPT max = std::numeric_limits<FPT>::max();
+    ranged_safe_float<FPT, FPT(0), max> const big(max);
+    ranged_safe_float<FPT, FPT(1), FPT(4)> const four(FPT(4));
+    ranged_safe_float<FPT, FPT(0), FPT(1)> const zero(FPT(0)), min(std::numeric_limits<FPT>::min());
+    BOOST_CHECK_THROW(big * four, std::exception);
+    BOOST_CHECK_THROW(four / zero, std::exception);
+    BOOST_CHECK_THROW(zero / zero, std::exception);
+    BOOST_CHECK_THROW(min * min, std::exception);
+    // the inexact checks are always kept
+    ranged_safe_float<FPT, FPT(1), FPT(4), policy::check_inexact_rounding_eft> const exact_four(FPT(4)),
+        exact_three(FPT(3));
+    BOOST_CHECK_THROW(exact_four / exact_three, std::exception);
+}
+
+#else
+
+BOOST_AUTO_TEST_CASE( safe_float_ranged_unavailable ){
+    BOOST_TEST_MESSAGE("ranged_safe_float needs the floating point template parameters of C++20");
+}
+
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,132 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/convenience.hpp>
+#include <boost/safe_float/reduce.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+// qualified calls, std::reduce is found by ADL through the iterators
+namespace safe = boost::safe_float;
+
+// handler recording the failures with their chunk, index and category
+struct recording_handler
+{
+    std::vector<reduction::failure_record>* records;
+    void report_failure(const std::string&) {}
+    void report_reduce_failure(const reduction::failure_record& record) { records->push_back(record); }
+};
+
+/**
+  This test suite checks the parallel reductions of safe_float and the order of the failures reported.
+  */
+BOOST_AUTO_TEST_SUITE( safe_float_reduce_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_reduce_values, FPT, test_types){
+    using sf = safe_float<FPT>;
+    std::vector<sf> values;
+    for (int i = 0; i < 100003; ++i) values.emplace_back(FPT(i % 1000 - 400));
+    reduction::options opts;
+    opts.chunk_size = 4096;
+    opts.threads = 4;
+    auto const reduced = [&opts](const std::vector<sf>& v, FPT init, auto op) {
+        return safe::reduce(v.begin(), v.end(), sf(init), op, opts).get_stored_value();
+    };
+    // the integer sums are exact in any order
+    FPT const sum = std::accumulate(values.begin(), values.end(), FPT(7),
+                                    [](FPT s, const sf& v) { return s + v.get_stored_value(); });
+    BOOST_CHECK_EQUAL(reduced(values, FPT(7), std::plus<>()), sum);
+    BOOST_CHECK_EQUAL(reduced(values, FPT(7), std::plus<sf>()), sum);
+    BOOST_CHECK_EQUAL(reduced(values, FPT(0), reduction::minimum()), FPT(-400));
+    BOOST_CHECK_EQUAL(reduced(values, FPT(0), reduction::maximum()), FPT(599));
+    // other operations are applied to the safe_float values
+    BOOST_CHECK_EQUAL(reduced(values, FPT(7), [](const sf& lhs, const sf& rhs) { return lhs + rhs; }), sum);
+    BOOST_CHECK_EQUAL(reduced(std::vector<sf>(), FPT(7), std::plus<>()), FPT(7));
+    opts.chunk_size = 3;
+    BOOST_CHECK_EQUAL(reduced(std::vector<sf>(40, sf(FPT(2))), FPT(1), std::multiplies<>()), FPT(1ull << 40));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_reduce_inexact_sum, FPT, test_types){
+    // the result depends on the chunk size only
+    using sf = safe_float<FPT, policy::check_overflow>;
+    std::vector<sf> values;
+    for (int i = 1; i < 50000; ++i) values.emplace_back(FPT(1) / FPT(i));
+    reduction::options one, many;
+    one.threads = 1;
+    many.threads = 7;
+    one.chunk_size = many.chunk_size = 1000;
+    BOOST_CHECK_EQUAL(safe::reduce(values.begin(), values.end(), sf(FPT(0)), std::plus<>(), one).get_stored_value(),
+                      safe::reduce(values.begin(), values.end(), sf(FPT(0)), std::plus<>(), many).get_stored_value());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_reduce_failures, FPT, test_types){
+    using sf = safe_float<FPT, policy::check_overflow>;
+    FPT const max = std::numeric_limits<FPT>::max();
+    std::vector<sf> values(10000, sf(FPT(1)));
+    // same lane of the chunks 2 and 4
+    values[2000] = values[2008] = values[4000] = values[4008] = sf(max);
+    reduction::options opts;
+    opts.chunk_size = 1000;
+    opts.threads = 3;
+    std::vector<reduction::failure_record> records;
+    recording_handler handler{&records};
+    safe::reduce(values.begin(), values.end(), sf(FPT(0)), std::plus<>(), opts, handler);
+    BOOST_REQUIRE_EQUAL(records.size(), 2u);
+    BOOST_CHECK_EQUAL(records[0].chunk, 2u);
+    BOOST_CHECK_EQUAL(records[0].index, 2008u);
+    BOOST_CHECK(records[0].category == policy::failure_category::overflow);
+    BOOST_CHECK_EQUAL(records[0].message, "Overflow to infinite on addition operation");
+    BOOST_CHECK_EQUAL(records[1].chunk, 4u);
+    BOOST_CHECK_EQUAL(records[1].index, 4008u);
+
+    // the partial results of the chunks 5 and 6 overflow once combined
+    std::vector<sf> halves(10000, sf(FPT(1)));
+    halves[5500] = halves[6500] = sf(max);
+    records.clear();
+    safe::reduce(halves.begin(), halves.end(), sf(FPT(0)), std::plus<>(), opts, handler);
+    BOOST_REQUIRE_EQUAL(records.size(), 1u);
+    BOOST_CHECK_EQUAL(records[0].chunk, 6u);
+    BOOST_CHECK_EQUAL(records[0].index, 6000u);
+    BOOST_CHECK(records[0].category == policy::failure_category::overflow);
+
+    // the first failure is thrown with its index
+    try
+    {
+        safe::reduce(values.begin(), values.end(), sf(FPT(0)), std::plus<>(), opts);
+        BOOST_ERROR("An exception is supposed to be thrown");
+    }
+    catch (policy::batch_failure& e)
+    {
+        BOOST_CHECK_EQUAL(e.index(), 2008u);
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_reduce_other_operation, FPT, test_types){
+    using sf = safe_float<FPT, policy::check_overflow>;
+    std::vector<sf> values(5000, sf(FPT(1)));
+    values[3001] = values[3002] = sf(std::numeric_limits<FPT>::max());
+    reduction::options opts;
+    opts.chunk_size = 1000;
+    auto const add = [](const sf& lhs, const sf& rhs) { return lhs + rhs; };
+    std::vector<reduction::failure_record> records;
+    safe::reduce(values.begin(), values.end(), sf(FPT(0)), add, opts, recording_handler{&records});
+    BOOST_REQUIRE_EQUAL(records.size(), 1u);
+    BOOST_CHECK_EQUAL(records[0].chunk, 3u);
+    BOOST_CHECK_EQUAL(records[0].index, 3002u);
+    BOOST_CHECK(records[0].category == policy::failure_category::unknown);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,129 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <limits>
+#include <string>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/simd.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double
+>;
+
+using namespace boost::safe_float;
+
+template<class FP, template<class T> class CHECK = policy::check_all>
+using simd4 = safe_simd<FP, 4, CHECK>;
+
+// handler without report_lane_failure gets the lanes in the message
+struct keep_message : policy::on_fail_policy
+{
+    inline static std::string message;
+    void report_failure(const std::string& s) { message = s; }
+};
+
+/**
+  This test suite checks the lanes of safe_simd are computed and checked as safe_float does.
+  */
+BOOST_AUTO_TEST_SUITE( safe_float_simd_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_simd_operations, FPT, test_types){
+    FPT const a_values[] = {1, 2, 3, 4}, b_values[] = {4, 3, 2, 1};
+    auto const a = simd4<FPT>::load(a_values);
+    auto const b = simd4<FPT>::load(b_values);
+
+    BOOST_CHECK(((a + b) == simd4<FPT>(FPT(5))) == 0xf);
+    BOOST_CHECK(((a - b) < simd4<FPT>(FPT(0))) == 0x3);
+    simd4<FPT> c = a * b;
+    BOOST_CHECK(c[0] == 4 && c[1] == 6 && c[2] == 6 && c[3] == 4);
+    c = b / simd4<FPT>(FPT(0.5));
+    BOOST_CHECK(c[0] == 8 && c[3] == 2);
+    BOOST_CHECK((-c)[1] == -6);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_simd_failing_lanes, FPT, test_types){
+    FPT const max = std::numeric_limits<FPT>::max();
+    FPT const a_values[] = {1, max, 1, max}, b_values[] = {1, 1, 1, max};
+    auto a = simd4<FPT, policy::check_overflow>::load(a_values);
+    auto const b = simd4<FPT, policy::check_overflow>::load(b_values);
+
+    // only the overflowing lane fails, rounding max + 1 doesn't overflow
+    try
+    {
+        a += b;
+        BOOST_ERROR("An exception is supposed to be thrown");
+    }
+    catch (policy::lane_failure& e)
+    {
+        BOOST_CHECK_EQUAL(e.lanes(), 0x8u);
+        BOOST_CHECK_EQUAL(e.first_lane(), 3u);
+        BOOST_CHECK_EQUAL(e.what(), std::string("Overflow to infinite on addition operation"));
+    }
+    // the lanes are unchanged
+    BOOST_CHECK(a[3] == max);
+
+    // the division by zero is detected on the pre check
+    FPT const z_values[] = {1, 0, 1, 0};
+    try
+    {
+        simd4<FPT>(FPT(1)) / simd4<FPT>::load(z_values);
+        BOOST_ERROR("An exception is supposed to be thrown");
+    }
+    catch (policy::lane_failure& e)
+    {
+        BOOST_CHECK_EQUAL(e.lanes(), 0xau);
+        BOOST_CHECK_EQUAL(e.first_lane(), 1u);
+        BOOST_CHECK_EQUAL(e.what(), std::string("Division by zero"));
+    }
+
+    // no lane set
+    BOOST_CHECK_EQUAL(policy::lane_failure("", 0).first_lane(), policy::lane_failure::no_lane);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_simd_underflow_and_invalid, FPT, test_types){
+    FPT const min = std::numeric_limits<FPT>::min();
+    FPT const inf = std::numeric_limits<FPT>::infinity();
+    // min / 3 is subnormal and inexact, the underflow flag is only raised for inexact results
+    FPT const a_values[] = {min, 1, inf, 1}, b_values[] = {3, 1, inf, 1};
+
+    BOOST_CHECK_EXCEPTION(simd4<FPT>::load(a_values) / simd4<FPT>::load(b_values), policy::lane_failure,
+                          [](const policy::lane_failure& e) { return e.lanes() == 0x5u; });
+    using invalid = simd4<FPT, policy::check_invalid_result>;
+    BOOST_CHECK_EXCEPTION(invalid::load(a_values) - invalid::load(b_values), policy::lane_failure,
+                          [](const policy::lane_failure& e) { return e.lanes() == 0x4u; });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_simd_lanes_in_message, FPT, test_types){
+    using logged = safe_simd<FPT, 4, policy::check_division_by_zero, keep_message>;
+    FPT const z_values[] = {0, 1, 0, 1};
+    keep_message::message.clear();
+    logged a = logged(FPT(1)) / logged::load(z_values);
+    BOOST_CHECK_EQUAL(keep_message::message, "Division by zero (lanes 0 2)");
+    // the operation is done when the handler doesn't throw
+    BOOST_CHECK(a[1] == 1 && a[2] == std::numeric_limits<FPT>::infinity());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_simd_safe_float_arrays, FPT, test_types){
+    safe_float<FPT> values[8];
+    for (int i = 0; i < 8; ++i) values[i] = safe_float<FPT>(FPT(i));
+    auto const v = simd4<FPT>::load(values + 2);
+    BOOST_CHECK(v[0] == 2 && v[3] == 5);
+    (v * simd4<FPT>(FPT(2))).store(values + 4);
+    BOOST_CHECK(values[3].get_stored_value() == 3);
+    BOOST_CHECK(values[4].get_stored_value() == 4);
+    BOOST_CHECK(values[7].get_stored_value() == 10);
+}
+
+BOOST_AUTO_TEST_CASE( safe_float_simd_wide_vectors ){
+    double values[8] = {1, 2, 3, 4, 5, 6, 7, std::numeric_limits<double>::max()};
+    auto v = safe_simd<double, 8>::load(values);
+    BOOST_CHECK_EXCEPTION(v * v, policy::lane_failure,
+                          [](const policy::lane_failure& e) { return e.lanes() == 0x80u; });
+    BOOST_CHECK_NO_THROW(v -= v);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
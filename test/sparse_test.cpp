@@ -0,0 +1,138 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/convenience.hpp>
+#include <boost/safe_float/sparse.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+// rows of 0 to 40 nonzeros of small integers, without 0: the products and their sums are exact in any order
+template<class SF>
+sparse::csr_matrix<SF> integer_matrix(std::size_t rows, std::size_t columns)
+{
+    std::vector<std::size_t> offsets{0}, indices;
+    std::vector<SF> values;
+    for (std::size_t r = 0; r < rows; ++r)
+    {
+        std::size_t const length = (r * 13) % 41;
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            int const v = int((r + i) % 9) - 4;
+            indices.push_back((r * 7 + i * 11) % columns);
+            values.emplace_back(typename SF::value_type(v < 0 ? v : v + 1));
+        }
+        offsets.push_back(values.size());
+    }
+    return sparse::csr_matrix<SF>(rows, columns, offsets, indices, values);
+}
+
+template<class SF>
+std::vector<SF> integer_vector(std::size_t size)
+{
+    std::vector<SF> x;
+    for (std::size_t i = 0; i < size; ++i) x.emplace_back(typename SF::value_type(i % 2 ? int(i % 5) + 1 : -2));
+    return x;
+}
+
+/**
+  This test suite checks the sparse matrix-vector product against the loops of the operators of safe_float and the
+  rows of the failures it reports.
+  */
+BOOST_AUTO_TEST_SUITE( safe_float_sparse_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_sparse_values, FPT, test_types){
+    using sf = safe_float<FPT>;
+    auto const a = integer_matrix<sf>(500, 97);
+    auto const x = integer_vector<sf>(97);
+    std::vector<sf> expected(a.rows());
+    for (std::size_t r = 0; r < a.rows(); ++r)
+    {
+        sf sum(FPT(0));
+        for (std::size_t i = a.row_offsets()[r]; i < a.row_offsets()[r + 1]; ++i)
+            sum += a.values()[i] * x[a.column_indices()[i]];
+        expected[r] = sum;
+    }
+    // blocks of a few rows on several threads, and the default options
+    sparse::options opts;
+    opts.threads = 3;
+    opts.block_nonzeros = 50;
+    for (const sparse::options& o : {opts, sparse::options{}})
+    {
+        std::vector<sf> y(a.rows());
+        sparse::spmv(a, x.data(), y.data(), o);
+        for (std::size_t r = 0; r < a.rows(); ++r)
+            BOOST_CHECK_EQUAL(y[r].get_stored_value(), expected[r].get_stored_value());
+    }
+
+    // the empty rows give 0
+    sparse::csr_matrix<sf> const empty(4, 97);
+    std::vector<sf> y(4, sf(FPT(1)));
+    sparse::spmv(empty, x.data(), y.data());
+    for (const sf& v : y) BOOST_CHECK_EQUAL(v.get_stored_value(), FPT(0));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_sparse_failing_row, FPT, test_types){
+    FPT const max = std::numeric_limits<FPT>::max();
+    sparse::options opts;
+    opts.threads = 4;
+    opts.block_nonzeros = 64;
+    auto const row_of_failure = [&opts](const auto& a, const auto& x) -> std::size_t {
+        std::vector<typename std::decay_t<decltype(a)>::value_type> y(a.rows());
+        try
+        {
+            sparse::spmv(a, x.data(), y.data(), opts);
+        }
+        catch (policy::batch_failure& e)
+        {
+            return e.index();
+        }
+        return std::size_t(-1);
+    };
+
+    // overflows in the rows 120 and 430, in different blocks
+    using of = safe_float<FPT, policy::check_overflow>;
+    auto a = integer_matrix<of>(500, 97);
+    auto const x = integer_vector<of>(97);
+    BOOST_CHECK_EQUAL(row_of_failure(a, x), std::size_t(-1));
+    a.values_data()[a.row_offsets()[430] + 3] = of(max);
+    a.values_data()[a.row_offsets()[120] + 1] = of(max);
+    BOOST_CHECK_EQUAL(row_of_failure(a, std::vector<of>(97, of(FPT(2)))), 120u);
+
+    // inf - inf in the sum of the row 7 gives NaN, the products overflowing are not checked
+    using ir = safe_float<FPT, policy::check_invalid_result>;
+    auto b = integer_matrix<ir>(500, 97);
+    auto const y = integer_vector<ir>(97);
+    std::size_t const first = b.row_offsets()[7];
+    for (std::size_t i = first; i < b.row_offsets()[8]; ++i) b.values_data()[i] = ir(FPT(1));
+    b.values_data()[first] = ir(max);
+    b.values_data()[first + 1] = ir(-max);
+    BOOST_CHECK_EQUAL(row_of_failure(b, std::vector<ir>(97, ir(FPT(4)))), 7u);
+    BOOST_CHECK_EQUAL(row_of_failure(b, y), std::size_t(-1));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_sparse_invalid_matrix, FPT, test_types){
+    using sf = safe_float<FPT>;
+    using offsets = std::vector<std::size_t>;
+    std::vector<sf> const values(3, sf(FPT(1)));
+    BOOST_CHECK_NO_THROW(sparse::csr_matrix<sf>(2, 4, offsets{0, 1, 3}, offsets{0, 3, 1}, values));
+    BOOST_CHECK_THROW(sparse::csr_matrix<sf>(2, 4, offsets{0, 3}, offsets{0, 3, 1}, values), std::invalid_argument);
+    BOOST_CHECK_THROW(sparse::csr_matrix<sf>(2, 4, offsets{0, 2, 1}, offsets{0, 3, 1}, values), std::invalid_argument);
+    BOOST_CHECK_THROW(sparse::csr_matrix<sf>(2, 4, offsets{0, 1, 3}, offsets{0, 3}, values), std::invalid_argument);
+    BOOST_CHECK_THROW(sparse::csr_matrix<sf>(2, 4, offsets{0, 1, 3}, offsets{0, 4, 1}, values), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
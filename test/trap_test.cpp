@@ -0,0 +1,153 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <future>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/trap.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+
+template<class FP>
+using trapped_float = safe_float<FP, policy::trapped<>::policy>;
+
+/**
+  This test suite checks the hardware trap scope reports the exceptions raised inside it.
+  */
+BOOST_AUTO_TEST_SUITE( safe_float_trap_test_suite )
+
+BOOST_AUTO_TEST_CASE( safe_float_trapped_policy_has_no_check ){
+    using traits = policy::policy_traits<double, policy::trapped<>::policy<double>>;
+    BOOST_CHECK( ! traits::has_pre_addition_check());
+    BOOST_CHECK( ! traits::has_post_addition_check());
+    BOOST_CHECK( ! traits::has_post_division_check());
+    BOOST_CHECK(policy::trapped<FE_OVERFLOW>::policy<double>::trapped_exceptions == FE_OVERFLOW);
+}
+
+// The operands are read and the results written through volatiles inside the scopes, otherwise the optimizer is
+// free to move the operations out of them.
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_trap_scope_success, FPT, test_types){
+    volatile FPT one = 1;
+    volatile FPT result = 0;
+    BOOST_CHECK_NO_THROW(([&]{
+        trap_scope<> scope;
+        trapped_float<FPT> a(one), b(one);
+        a += b;
+        a *= b;
+        a /= b;
+        result = a.get_stored_value();
+    }()));
+    BOOST_CHECK(result == 2);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_trap_scope_overflow, FPT, test_types){
+    volatile FPT max = std::numeric_limits<FPT>::max();
+    volatile FPT result = 0;
+    BOOST_CHECK_THROW(([&]{
+        trap_scope<> scope;
+        trapped_float<FPT> a(max), b(max);
+        a += b;
+        result = a.get_stored_value();
+    }()), std::runtime_error);
+    // the trap is masked, the operation gave its default result
+    BOOST_CHECK(result == std::numeric_limits<FPT>::infinity());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_trap_scope_division_by_zero, FPT, test_types){
+    volatile FPT one = 1;
+    volatile FPT zero = 0;
+    volatile FPT result = 0;
+    try
+    {
+        trap_scope<> scope(FE_DIVBYZERO);
+        trapped_float<FPT> a(one), b(zero);
+        a /= b;
+        result = a.get_stored_value();
+        BOOST_CHECK(scope.raised() == FE_DIVBYZERO);
+        BOOST_CHECK_THROW(scope.check(), std::runtime_error);
+        BOOST_CHECK(scope.raised() == 0);
+        BOOST_CHECK(result == std::numeric_limits<FPT>::infinity());
+    }
+    catch (std::exception&)
+    {
+        BOOST_ERROR("the failure has already been reported by check()");
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_trap_scope_two_exceptions, FPT, test_types){
+    // the first trap doesn't mask the other exceptions
+    volatile FPT max = std::numeric_limits<FPT>::max();
+    volatile FPT zero = 0;
+    volatile FPT result = 0;
+    BOOST_CHECK_THROW(([&]{
+        trap_scope<> scope;
+        trapped_float<FPT> a(max), b(max), c(max), d(zero);
+        a += b;
+        result = a.get_stored_value();
+        c /= d;
+        result = c.get_stored_value();
+        BOOST_CHECK(scope.raised() == (FE_OVERFLOW | FE_DIVBYZERO));
+    }()), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE( safe_float_trap_scope_for_policy ){
+    volatile double zero = 0;
+    volatile double result = 0;
+    BOOST_CHECK_THROW(([&]{
+        auto scope = trap_scope<>::for_policy<policy::trapped<FE_INVALID>::policy>();
+        trapped_float<double> a(zero), b(zero);
+        a /= b;
+        result = a.get_stored_value();
+    }()), std::runtime_error);
+    // not trapped exceptions are left alone
+    BOOST_CHECK_NO_THROW(([&]{
+        auto scope = trap_scope<>::for_policy<policy::trapped<FE_OVERFLOW>::policy>();
+        trapped_float<double> a(zero), b(zero);
+        a /= b;
+        result = a.get_stored_value();
+    }()));
+}
+
+// The SIGFPE handler stays installed until the last scope of the process is left, even out of order on other threads
+BOOST_AUTO_TEST_CASE( safe_float_trap_scope_threads ){
+    std::optional<trap_scope<>> first(std::in_place);
+    std::promise<void> entered, first_left;
+    int raised = 0;
+    std::thread other([&] {
+        volatile double one = 1;
+        volatile double zero = 0;
+        volatile double result = 0;
+        try
+        {
+            trap_scope<> scope(FE_DIVBYZERO);
+            entered.set_value();
+            first_left.get_future().wait();
+            trapped_float<double> a(one), b(zero);
+            a /= b;
+            result = a.get_stored_value();
+            raised = scope.raised();
+        }
+        catch (std::exception&)
+        {
+        }
+        (void)result;
+    });
+    entered.get_future().wait();
+    first.reset();
+    first_left.set_value();
+    other.join();
+    BOOST_CHECK_EQUAL(raised, FE_DIVBYZERO);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,87 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/list.hpp>
+
+#include <limits>
+#include <vector>
+
+#include <boost/safe_float.hpp>
+#include <boost/safe_float/convenience.hpp>
+#include <boost/safe_float/validate.hpp>
+
+//types to be tested
+using test_types=boost::mpl::list<
+    float, double, long double
+>;
+
+using namespace boost::safe_float;
+using namespace boost::safe_float::validation;
+
+/**
+  This test suite checks the validation of arrays of FP, in the vectors and the remaining values, and their use as
+  arrays of safe_float.
+  */
+BOOST_AUTO_TEST_SUITE( safe_float_validate_test_suite )
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_validate_classes, FPT, test_types){
+    using limits = std::numeric_limits<FPT>;
+    std::vector<FPT> values(301, FPT(1.5));
+    values[7] = 0;
+    values[8] = -limits::max();
+    BOOST_CHECK(validate(values.data(), values.size(), all));
+    // in the vectors, in the remaining values, at the end
+    for (std::size_t index : {std::size_t(0), std::size_t(130), std::size_t(299), std::size_t(300)})
+    {
+        auto copy = values;
+        copy[index] = -limits::infinity();
+        copy[index + 1 < copy.size() ? index + 1 : 0] = limits::quiet_NaN();
+        result const r = validate(copy.data(), copy.size());
+        BOOST_CHECK(!r);
+        BOOST_CHECK_EQUAL(r.index, index == 300 ? 0 : index);
+        BOOST_CHECK(r.category == (index == 300 ? value_class::nan : value_class::infinite));
+    }
+    values[200] = limits::denorm_min();
+    BOOST_CHECK(validate(values.data(), values.size(), non_finite));
+    result const r = validate(values.data(), values.size(), all);
+    BOOST_CHECK_EQUAL(r.index, 200u);
+    BOOST_CHECK(r.category == value_class::subnormal);
+    values[100] = limits::infinity();
+    BOOST_CHECK_EQUAL(validate(values.data(), values.size(), value_class::nan).index, values.size());
+    BOOST_CHECK_EQUAL(validate(values.data(), values.size(), value_class::infinite).index, 100u);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( safe_float_validate_in_place, FPT, test_types){
+    std::vector<FPT> values(100, FPT(0.5));
+    safe_float<FPT>* const sf = as_safe_float<safe_float<FPT>>(values.data(), values.size());
+    BOOST_CHECK(static_cast<void*>(sf) == static_cast<void*>(values.data()));
+    BOOST_CHECK_EQUAL((sf[3] + sf[4]).get_stored_value(), FPT(1));
+    // the default safe_float detects underflows, check_finite doesn't
+    values[42] = std::numeric_limits<FPT>::denorm_min();
+    try
+    {
+        as_safe_float<safe_float<FPT>>(values.data(), values.size());
+        BOOST_ERROR("An exception is supposed to be thrown");
+    }
+    catch (policy::batch_failure& e)
+    {
+        BOOST_CHECK_EQUAL(e.what(), "Subnormal value");
+        BOOST_CHECK_EQUAL(e.index(), 42u);
+    }
+    BOOST_CHECK_NO_THROW((as_safe_float<safe_float<FPT, policy::check_finite>>(values.data(), values.size())));
+}
+
+#ifdef __cpp_lib_span
+BOOST_AUTO_TEST_CASE( safe_float_validate_span ){
+    std::vector<double> values(10, 2.0);
+    BOOST_CHECK(validate(std::span<const double>(values)));
+    std::span<safe_float<double>> const sf = as_safe_float<safe_float<double>>(std::span<double>(values));
+    BOOST_CHECK_EQUAL(sf.size(), values.size());
+    sf[1] = sf[0] * sf[0];
+    BOOST_CHECK_EQUAL(values[1], 4.0);
+    values[9] = std::numeric_limits<double>::quiet_NaN();
+    BOOST_CHECK_THROW(as_safe_float<safe_float<double>>(std::span<const double>(values)), std::exception);
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()